@@ -0,0 +1,22 @@
+#!/bin/sh
+# Synthesizes the module "Adder" for every adder style at 8 and 16 bit with an
+# open-source flow (GHDL and yosys with the ghdl plugin) for a 7-series FPGA.
+# "stat" prints the number of used LUTs, "ltp -noff" the longest path (logic
+# levels from an input to an output).
+# Has to be called from the folder "benchmarks".
+
+SOURCES="../vhdl_files/source/Full_Adder.vhd \
+         ../vhdl_files/source/Serial_Adder.vhd \
+         ../vhdl_files/source/Adder.vhd"
+
+for BITS in 8 16
+do
+  for STYLE in RIPPLE CLA CARRY_SELECT KOGGE_STONE
+  do
+    echo "--- $STYLE, g_bit = $BITS ---"
+    yosys -m ghdl -p "ghdl -gg_bit=$BITS -gg_adder_style=$STYLE $SOURCES -e Adder; \
+                      synth_xilinx -family xc7 -top Adder; \
+                      stat; \
+                      ltp -noff" | grep -E "LUT[1-6]|Longest topological path"
+  done
+done
@@ -0,0 +1,25 @@
+#!/bin/sh
+# Synthesizes the module "Event_Controller" for both debounce styles with 2, 8
+# and 16 interrupt lines (17 bit debounce counter, about 13 ms at 10 MHz) with
+# an open-source flow (GHDL and yosys with the ghdl plugin) for a 7-series 
+# FPGA. "stat" prints the number of used LUTs and flip-flops.
+# Has to be called from the folder "benchmarks".
+
+SOURCES="../vhdl_files/source/Flip_Flop.vhd \
+         ../vhdl_files/source/Synchronizer.vhd \
+         ../vhdl_files/source/Debouncer.vhd \
+         ../vhdl_files/source/Edge_Detection.vhd \
+         ../vhdl_files/source/Event_Controller.vhd"
+
+for LINES in 2 8 16
+do
+  for STYLE in COUNTER SHARED
+  do
+    echo "--- $STYLE, g_int_lines = $LINES ---"
+    yosys -m ghdl -p "ghdl -gg_bit_size_counter=17 -gg_bit_size=8 \
+                      -gg_int_lines=$LINES -gg_debounce_style=$STYLE \
+                      $SOURCES -e Event_Controller; \
+                      synth_xilinx -family xc7 -top Event_Controller; \
+                      stat" | grep -E "LUT[1-6]|FD[RSCP]E"
+  done
+done
@@ -0,0 +1,607 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2018, Bernhard Vacarescu
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#define FILE_OPEN_ERROR 1
+#define FILE_WRITE_ERROR 2
+#define FILE_FORMAT_ERROR 3
+#define MEMORY_ALLOCATION_ERROR 4
+
+#define MPM_SIZE 4096 // number of microinstructions
+#define MPC_SIZE 12   // bit size of the MPC (inputs of every function)
+#define MIR_SIZE 40   // bit size of one microinstruction (functions)
+#define CUBE_RANGE 531441 // 3**MPC_SIZE (every input is 0, 1 or "don't care")
+#define SET_WORDS (MPM_SIZE / 64) // words of a minterm set
+
+// Pattern used for unused MPM rows (jump to 0xFFF). These rows are treated
+// as "don't cares", except the row 0xFFF itself (trap for wrong jumps).
+#define FILLER "0011111100000111111111111111111111111111"
+#define TRAP_ADDRESS 0xFFF
+
+#define VHDL_FILENAME "MPM_Logic.vhd"
+
+#define LINE_WIDTH 80  // max. line length of the created VHDL file
+#define TERM_INDENT 17 // indent of the product terms ("    o_MIR(xx) <= ")
+
+#define LINE_SIZE 64 // Max. string length: LINE_SIZE - 1 ('0' byte).
+                     // In program max. length of LINE_SIZE - 2 used.
+                     // Length of LINE_SIZE - 1 used to check if too long.
+
+typedef struct
+{
+  uint16_t value; // bit = 1: input has to be 1 (if not "don't care")
+  uint16_t mask;  // bit = 1: input is used (no "don't care")
+  uint64_t set[SET_WORDS]; // covered minterms of the on-set
+} Cube;
+
+static char rom[MPM_SIZE][MIR_SIZE + 2];
+static int care[MPM_SIZE];
+static int pow3[MPC_SIZE + 1];
+static int ternary_order[CUBE_RANGE]; // cube numbers sorted by "don't cares"
+static uint8_t implicant[CUBE_RANGE];
+static uint8_t merged[CUBE_RANGE];
+
+void initTernary(void);
+int countBits(uint64_t word);
+int minimizeBit(int bit, Cube** cover);
+int writeHeader(FILE* fp);
+void writeCube(Cube* cube, int* column, FILE* fp);
+
+
+// Sorts all cube numbers by their number of "don't care" digits (digit 2).
+void initTernary(void)
+{
+  static int dash_count[CUBE_RANGE];
+  int counter = 0;
+  int digit = 0;
+  int dashes = 0;
+  int position = 0;
+
+  pow3[0] = 1;
+  for(digit = 1; digit <= MPC_SIZE; digit++)
+  {
+    pow3[digit] = pow3[digit - 1] * 3;
+  }
+
+  for(counter = 0; counter < CUBE_RANGE; counter++)
+  {
+    dash_count[counter] = 0;
+    for(digit = 0; digit < MPC_SIZE; digit++)
+    {
+      if((counter / pow3[digit]) % 3 == 2)
+      {
+        dash_count[counter]++;
+      }
+    }
+  }
+
+  for(dashes = 0; dashes <= MPC_SIZE; dashes++)
+  {
+    for(counter = 0; counter < CUBE_RANGE; counter++)
+    {
+      if(dash_count[counter] == dashes)
+      {
+        ternary_order[position++] = counter;
+      }
+    }
+  }
+}
+
+
+int countBits(uint64_t word)
+{
+  int count = 0;
+
+  while(word != 0)
+  {
+    word &= word - 1;
+    count++;
+  }
+  return count;
+}
+
+
+// Two-level minimization (Quine-McCluskey) of one MIR bit as a function of
+// the MPC. The cover (prime implicants) is returned in "cover", the return
+// value is the number of product terms (-1: constant 1, -2: memory error).
+int minimizeBit(int bit, Cube** cover)
+{
+  uint64_t on_set[SET_WORDS];
+  uint64_t uncovered[SET_WORDS];
+  Cube* primes = NULL;
+  int prime_count = 0;
+  int prime_size = 0;
+  int term_count = 0;
+  int counter = 0;
+  int digit = 0;
+  int word = 0;
+
+  memset(implicant, 0, sizeof(implicant));
+  memset(merged, 0, sizeof(merged));
+  memset(on_set, 0, sizeof(on_set));
+
+  // minterms (cubes without "don't care" digits) of on-set and dc-set
+  for(counter = 0; counter < MPM_SIZE; counter++)
+  {
+    int cube = 0;
+
+    for(digit = 0; digit < MPC_SIZE; digit++)
+    {
+      cube += ((counter >> digit) & 1) * pow3[digit];
+    }
+    if(care[counter] == 0)
+    {
+      implicant[cube] = 1;
+    }
+    else if(rom[counter][MIR_SIZE - 1 - bit] == '1')
+    {
+      implicant[cube] = 1;
+      on_set[counter / 64] |= (uint64_t)1 << (counter % 64);
+    }
+  }
+
+  // merge implicants pairwise (cubes with less "don't cares" first)
+  for(counter = 0; counter < CUBE_RANGE; counter++)
+  {
+    int cube = ternary_order[counter];
+
+    if(implicant[cube] == 0)
+    {
+      continue;
+    }
+    for(digit = 0; digit < MPC_SIZE; digit++)
+    {
+      if((cube / pow3[digit]) % 3 == 0 && implicant[cube + pow3[digit]])
+      {
+        implicant[cube + 2 * pow3[digit]] = 1;
+        merged[cube] = 1;
+        merged[cube + pow3[digit]] = 1;
+      }
+    }
+  }
+
+  // collect prime implicants covering at least one minterm of the on-set
+  for(counter = 0; counter < CUBE_RANGE; counter++)
+  {
+    Cube prime;
+    int minterm = 0;
+    int used = 0;
+
+    if(implicant[counter] == 0 || merged[counter] == 1)
+    {
+      continue;
+    }
+
+    prime.value = 0;
+    prime.mask = 0;
+    for(digit = 0; digit < MPC_SIZE; digit++)
+    {
+      switch((counter / pow3[digit]) % 3)
+      {
+        case 0: prime.mask |= 1 << digit; break;
+        case 1: prime.mask |= 1 << digit; prime.value |= 1 << digit; break;
+        default: break;
+      }
+    }
+    if(prime.mask == 0)
+    {
+      // only possible if the whole function is 1 (or "don't care")
+      free(primes);
+      return -1;
+    }
+
+    memset(prime.set, 0, sizeof(prime.set));
+    for(minterm = 0; minterm < MPM_SIZE; minterm++)
+    {
+      if(((minterm & prime.mask) == prime.value) &&
+         (on_set[minterm / 64] & ((uint64_t)1 << (minterm % 64))))
+      {
+        prime.set[minterm / 64] |= (uint64_t)1 << (minterm % 64);
+        used = 1;
+      }
+    }
+    if(used == 0)
+    {
+      continue;
+    }
+
+    if(prime_count == prime_size)
+    {
+      Cube* resized = NULL;
+
+      prime_size = (prime_size == 0) ? 256 : 2 * prime_size;
+      resized = realloc(primes, prime_size * sizeof(Cube));
+      if(resized == NULL)
+      {
+        free(primes);
+        return -2;
+      }
+      primes = resized;
+    }
+    primes[prime_count++] = prime;
+  }
+
+  // cover the on-set: essential prime implicants first, then always the
+  // prime implicant covering most of the remaining minterms (fewest inputs
+  // if equal)
+  *cover = malloc((prime_count > 0 ? prime_count : 1) * sizeof(Cube));
+  if(*cover == NULL)
+  {
+    free(primes);
+    return -2;
+  }
+  memcpy(uncovered, on_set, sizeof(on_set));
+
+  for(counter = 0; counter < MPM_SIZE; counter++)
+  {
+    int found = -1;
+    int number = 0;
+    int search = 0;
+
+    if((uncovered[counter / 64] & ((uint64_t)1 << (counter % 64))) == 0)
+    {
+      continue;
+    }
+    for(search = 0; search < prime_count; search++)
+    {
+      if(primes[search].set[counter / 64] & ((uint64_t)1 << (counter % 64)))
+      {
+        found = search;
+        number++;
+      }
+    }
+    if(number == 1)
+    {
+      (*cover)[term_count++] = primes[found];
+      for(word = 0; word < SET_WORDS; word++)
+      {
+        uncovered[word] &= ~primes[found].set[word];
+      }
+    }
+  }
+
+  while(1)
+  {
+    int best = -1;
+    int best_count = 0;
+    int best_inputs = MPC_SIZE + 1;
+    int search = 0;
+
+    for(search = 0; search < prime_count; search++)
+    {
+      int count = 0;
+      int inputs = countBits(primes[search].mask);
+
+      for(word = 0; word < SET_WORDS; word++)
+      {
+        count += countBits(primes[search].set[word] & uncovered[word]);
+      }
+      if(count > best_count || (count == best_count && count > 0 &&
+                                inputs < best_inputs))
+      {
+        best = search;
+        best_count = count;
+        best_inputs = inputs;
+      }
+    }
+    if(best < 0)
+    {
+      break;
+    }
+    (*cover)[term_count++] = primes[best];
+    for(word = 0; word < SET_WORDS; word++)
+    {
+      uncovered[word] &= ~primes[best].set[word];
+    }
+  }
+
+  free(primes);
+  return term_count;
+}
+
+
+// Writes license and description of the generated module.
+int writeHeader(FILE* fp)
+{
+  fprintf(fp,
+    "-- BSD 3-Clause License\n"
+    "-- \n"
+    "-- Copyright (c) 2018, Bernhard Vacarescu\n"
+    "-- All rights reserved.\n"
+    "-- \n"
+    "-- Redistribution and use in source and binary forms, with or without\n"
+    "-- modification, are permitted provided that the following conditions "
+    "are met:\n"
+    "-- \n"
+    "-- * Redistributions of source code must retain the above copyright "
+    "notice, this\n"
+    "--   list of conditions and the following disclaimer.\n"
+    "-- \n"
+    "-- * Redistributions in binary form must reproduce the above copyright "
+    "notice,\n"
+    "--   this list of conditions and the following disclaimer in the "
+    "documentation\n"
+    "--   and/or other materials provided with the distribution.\n"
+    "-- \n"
+    "-- * Neither the name of the copyright holder nor the names of its\n"
+    "--   contributors may be used to endorse or promote products derived "
+    "from\n"
+    "--   this software without specific prior written permission.\n"
+    "-- \n"
+    "-- THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "
+    "\"AS IS\"\n"
+    "-- AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, "
+    "THE\n"
+    "-- IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR "
+    "PURPOSE ARE\n"
+    "-- DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE "
+    "LIABLE\n"
+    "-- FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR "
+    "CONSEQUENTIAL\n"
+    "-- DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE "
+    "GOODS OR\n"
+    "-- SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) "
+    "HOWEVER\n"
+    "-- CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT "
+    "LIABILITY,\n"
+    "-- OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF "
+    "THE USE\n"
+    "-- OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.\n"
+    "\n"
+    "\n"
+    "------------------------------------------------------------------------"
+    "----------\n"
+    "-- MPM LOGIC\n"
+    "------------------------------------------------------------------------"
+    "----------\n"
+    "-- Microprogram memory as combinational logic: every MIR bit is a "
+    "two-level\n"
+    "-- (sum of products) function of the MPC. Unused rows of the ROM file "
+    "are\n"
+    "-- treated as \"don't cares\" (except the trap row 0xFFF).\n"
+    "-- Generated by the \"logic_rom_creator\" from the ROM file, do not edit "
+    "(the\n"
+    "-- file has to be created again every time the ROM file changes).\n"
+    "------------------------------------------------------------------------"
+    "----------\n"
+    "\n"
+    "library IEEE;\n"
+    "use IEEE.STD_LOGIC_1164.ALL;\n"
+    "\n"
+    "entity MPM_Logic is\n"
+    "    Port (\n"
+    "      i_MPC : in STD_LOGIC_VECTOR (11 downto 0);\n"
+    "      o_MIR : out STD_LOGIC_VECTOR (39 downto 0)\n"
+    "    );\n"
+    "end MPM_Logic;\n"
+    "\n"
+    "\n"
+    "\n"
+    "architecture Dataflow of MPM_Logic is\n"
+    "begin\n"
+    "\n");
+  return ferror(fp);
+}
+
+
+// Writes one product term, e.g. "(not i_MPC(11) and i_MPC(4))". Lines are
+// wrapped before reaching LINE_WIDTH, "column" is the current column.
+void writeCube(Cube* cube, int* column, FILE* fp)
+{
+  char literal[LINE_SIZE];
+  int digit = 0;
+  int first = 1;
+  int inputs = countBits(cube->mask);
+
+  if(inputs > 1)
+  {
+    fputc('(', fp);
+    (*column)++;
+  }
+  for(digit = MPC_SIZE - 1; digit >= 0; digit--)
+  {
+    if((cube->mask & (1 << digit)) == 0)
+    {
+      continue;
+    }
+    sprintf(literal, "%s%si_MPC(%d)", (first == 0) ? " and " : "",
+            ((cube->value & (1 << digit)) == 0) ? "not " : "", digit);
+    if(*column + (int)strlen(literal) + 4 > LINE_WIDTH) // ") or"
+    {
+      fprintf(fp, "\n%*s", TERM_INDENT, "");
+      *column = TERM_INDENT;
+    }
+    *column += fprintf(fp, "%s", literal);
+    first = 0;
+  }
+  if(inputs > 1)
+  {
+    fputc(')', fp);
+    (*column)++;
+  }
+}
+
+
+int main()
+{
+  char rom_filename[LINE_SIZE - 1];
+  char line[LINE_SIZE];
+  int counter = 0;
+  int bit = 0;
+  int total_terms = 0;
+  int total_inputs = 0;
+  int max_terms = 0;
+
+  // Get arguments from stdin
+  do
+  {
+    printf("Enter ROM file name (max. %d characters) "
+           "- e.g. ROM_MEM.txt: ", LINE_SIZE - 2);
+    fgets(line, sizeof(line), stdin);
+    sscanf(line, "%s", rom_filename);
+    if(line[strlen(line) - 1] != '\n')
+    {
+      // flush stdin
+      // never considers EOF
+      while(getchar() != '\n');
+    }
+  }while(strlen(rom_filename) > (LINE_SIZE - 2));
+
+
+  FILE* fp_rom;
+  fp_rom = fopen(rom_filename, "r");
+  if(fp_rom == NULL)
+  {
+    printf("Could not open file!");
+    getchar();
+    return FILE_OPEN_ERROR;
+  }
+
+  for(counter = 0; counter < MPM_SIZE; counter++)
+  {
+    if((fgets(line, sizeof(line), fp_rom) == NULL) ||
+       (sscanf(line, "%40[01]", rom[counter]) != 1) ||
+       (strlen(rom[counter]) != MIR_SIZE))
+    {
+      printf("Wrong ROM file format in line %d!", counter + 1);
+      fclose(fp_rom);
+      getchar();
+      return FILE_FORMAT_ERROR;
+    }
+    care[counter] = (strcmp(rom[counter], FILLER) != 0) ||
+                    (counter == TRAP_ADDRESS);
+  }
+  fclose(fp_rom);
+
+
+  FILE* fp_vhdl;
+  fp_vhdl = fopen(VHDL_FILENAME, "w");
+  if(fp_vhdl == NULL)
+  {
+    printf("Could not open file!");
+    getchar();
+    return FILE_OPEN_ERROR;
+  }
+
+  printf("Writing logic to \"%s\"...\n\n", VHDL_FILENAME);
+
+  if(writeHeader(fp_vhdl))
+  {
+    printf("Error writing file!");
+    fclose(fp_vhdl);
+    getchar();
+    return FILE_WRITE_ERROR;
+  }
+
+  initTernary();
+
+  for(bit = MIR_SIZE - 1; bit >= 0; bit--)
+  {
+    Cube* cover = NULL;
+    int term_count = minimizeBit(bit, &cover);
+    int inputs = 0;
+
+    if(term_count == -2)
+    {
+      printf("Could not allocate memory!");
+      fclose(fp_vhdl);
+      getchar();
+      return MEMORY_ALLOCATION_ERROR;
+    }
+
+    int column = fprintf(fp_vhdl, "    o_MIR(%d) <= ", bit);
+
+    if(term_count == -1)
+    {
+      fprintf(fp_vhdl, "'1';\n");
+    }
+    else if(term_count == 0)
+    {
+      fprintf(fp_vhdl, "'0';\n");
+    }
+    else
+    {
+      for(counter = 0; counter < term_count; counter++)
+      {
+        if(counter > 0)
+        {
+          fprintf(fp_vhdl, " or\n%*s", TERM_INDENT, "");
+          column = TERM_INDENT;
+        }
+        writeCube(&cover[counter], &column, fp_vhdl);
+        inputs += countBits(cover[counter].mask);
+      }
+      fprintf(fp_vhdl, ";\n");
+    }
+    free(cover);
+
+    if(term_count < 0)
+    {
+      term_count = 0;
+    }
+    printf("MIR(%2d): %4d product terms, %5d inputs\n", bit, term_count,
+           inputs);
+    total_terms += term_count;
+    total_inputs += inputs;
+    if(term_count > max_terms)
+    {
+      max_terms = term_count;
+    }
+  }
+
+  fprintf(fp_vhdl, "\nend Dataflow;\n");
+
+  if(ferror(fp_vhdl))
+  {
+    printf("Error writing file!");
+    fclose(fp_vhdl);
+    getchar();
+    return FILE_WRITE_ERROR;
+  }
+  fclose(fp_vhdl);
+
+  printf("\n");
+  printf("total:   %4d product terms, %5d inputs "
+         "(max. %d product terms for one bit)\n",
+         total_terms, total_inputs, max_terms);
+  printf("\n");
+
+  printf("FINISHED!");
+  getchar();
+
+  return 0;
+}
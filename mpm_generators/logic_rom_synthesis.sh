@@ -0,0 +1,11 @@
+#!/bin/sh
+# Synthesizes the module "MPM_Logic" with an open-source flow (GHDL and yosys 
+# with the ghdl plugin) for a 7-series FPGA. "stat" prints the number of used
+# LUTs (and MUXF7/MUXF8), "ltp -noff" the longest path (logic levels from the
+# MPC to a MIR bit).
+# Has to be called from the folder "mpm_generators".
+
+yosys -m ghdl -p "ghdl ../vhdl_files/source/MPM_Logic.vhd -e MPM_Logic; \
+                  synth_xilinx -family xc7 -top MPM_Logic; \
+                  stat; \
+                  ltp -noff"
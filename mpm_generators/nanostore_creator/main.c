@@ -0,0 +1,270 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2018, Bernhard Vacarescu
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FILE_OPEN_ERROR 1
+#define FILE_WRITE_ERROR 2
+#define FILE_FORMAT_ERROR 3
+
+#define MPM_SIZE 4096 // number of microinstructions
+#define MIR_SIZE 40   // bit size of one microinstruction
+#define ADDR_SIZE 12  // bit size of the jump address (ADDR field, bits 11-0)
+#define CONTROL_SIZE (MIR_SIZE - ADDR_SIZE) // bits 39-12 (OP ... A field)
+
+// Control part of the pattern used for unused MPM rows (jump to 0xFFF) and of
+// the power up value of the MIR (jump to 0x000). It is always stored at index
+// 0 of the nanostore, so a cleared microstore word (index 0, address 0x000)
+// is the power up microinstruction.
+#define FILLER_CONTROL "0011111100000111111111111111"
+
+#define MICRO_FILENAME "MICRO_MEM.txt"
+#define NANO_FILENAME "NANO_MEM.txt"
+
+#define LINE_SIZE 64 // Max. string length: LINE_SIZE - 1 ('0' byte).
+                     // In program max. length of LINE_SIZE - 2 used.
+                     // Length of LINE_SIZE - 1 used to check if too long.
+
+// RAMB36 (7-series) used as 4K x 9 bit: words per block and bits per word
+#define BRAM_DEPTH 4096
+#define BRAM_WIDTH 9
+
+int bitSize(int number);
+int divideRoundUp(int dividend, int divisor);
+
+
+// Returns the number of bits needed to address "number" different entries
+// (at least one bit).
+int bitSize(int number)
+{
+  int size = 1;
+
+  while((1 << size) < number)
+  {
+    size++;
+  }
+  return size;
+}
+
+
+int divideRoundUp(int dividend, int divisor)
+{
+  return (dividend + divisor - 1) / divisor;
+}
+
+
+int main()
+{
+  char rom_filename[LINE_SIZE - 1];
+  char line[LINE_SIZE];
+  static char rom[MPM_SIZE][MIR_SIZE + 1];
+  static char nano[MPM_SIZE][CONTROL_SIZE + 1];
+  static int index[MPM_SIZE];
+  int nano_size = 0;
+  int index_size = 0;
+  int counter = 0;
+  int search = 0;
+
+  // Get arguments from stdin
+  do
+  {
+    printf("Enter ROM file name (max. %d characters) "
+           "- e.g. ROM_MEM.txt: ", LINE_SIZE - 2);
+    fgets(line, sizeof(line), stdin);
+    sscanf(line, "%s", rom_filename);
+    if(line[strlen(line) - 1] != '\n')
+    {
+      // flush stdin
+      // never considers EOF
+      while(getchar() != '\n');
+    }
+  }while(strlen(rom_filename) > (LINE_SIZE - 2));
+
+
+  FILE* fp_rom;
+  fp_rom = fopen(rom_filename, "r");
+  if(fp_rom == NULL)
+  {
+    printf("Could not open file!");
+    getchar();
+    return FILE_OPEN_ERROR;
+  }
+
+  for(counter = 0; counter < MPM_SIZE; counter++)
+  {
+    if((fgets(line, sizeof(line), fp_rom) == NULL) ||
+       (sscanf(line, "%40[01]", rom[counter]) != 1) ||
+       (strlen(rom[counter]) != MIR_SIZE))
+    {
+      printf("Wrong ROM file format in line %d!", counter + 1);
+      fclose(fp_rom);
+      getchar();
+      return FILE_FORMAT_ERROR;
+    }
+  }
+  fclose(fp_rom);
+
+
+  // Split every microinstruction into its control part (nanostore) and its
+  // jump address. Equal control parts share one nanostore entry.
+  strcpy(nano[0], FILLER_CONTROL);
+  nano_size = 1;
+
+  for(counter = 0; counter < MPM_SIZE; counter++)
+  {
+    for(search = 0; search < nano_size; search++)
+    {
+      if(strncmp(nano[search], rom[counter], CONTROL_SIZE) == 0)
+      {
+        break;
+      }
+    }
+    if(search == nano_size)
+    {
+      memcpy(nano[nano_size], rom[counter], CONTROL_SIZE);
+      nano[nano_size][CONTROL_SIZE] = '\0';
+      nano_size++;
+    }
+    index[counter] = search;
+  }
+
+  index_size = bitSize(nano_size);
+
+
+  FILE* fp_micro;
+  fp_micro = fopen(MICRO_FILENAME, "w");
+  if(fp_micro == NULL)
+  {
+    printf("Could not open file!");
+    getchar();
+    return FILE_OPEN_ERROR;
+  }
+
+  printf("Writing microstore to \"%s\"...\n", MICRO_FILENAME);
+
+  for(counter = 0; counter < MPM_SIZE; counter++)
+  {
+    for(search = index_size - 1; search >= 0; search--)
+    {
+      fputc(((index[counter] >> search) & 1) ? '1' : '0', fp_micro);
+    }
+    fprintf(fp_micro, "%s\n", &rom[counter][CONTROL_SIZE]);
+  }
+
+  if(ferror(fp_micro))
+  {
+    printf("Error writing file!");
+    fclose(fp_micro);
+    getchar();
+    return FILE_WRITE_ERROR;
+  }
+  fclose(fp_micro);
+
+
+  FILE* fp_nano;
+  fp_nano = fopen(NANO_FILENAME, "w");
+  if(fp_nano == NULL)
+  {
+    printf("Could not open file!");
+    getchar();
+    return FILE_OPEN_ERROR;
+  }
+
+  printf("Writing nanostore to \"%s\"...\n", NANO_FILENAME);
+
+  // unused entries are filled with the filler pattern
+  for(counter = 0; counter < (1 << index_size); counter++)
+  {
+    if(counter < nano_size)
+    {
+      fprintf(fp_nano, "%s\n", nano[counter]);
+    }
+    else
+    {
+      fprintf(fp_nano, "%s\n", FILLER_CONTROL);
+    }
+  }
+
+  if(ferror(fp_nano))
+  {
+    printf("Error writing file!");
+    fclose(fp_nano);
+    getchar();
+    return FILE_WRITE_ERROR;
+  }
+  fclose(fp_nano);
+
+
+  // Report
+  long flat_bits = (long)MPM_SIZE * MIR_SIZE;
+  long micro_bits = (long)MPM_SIZE * (index_size + ADDR_SIZE);
+  long nano_bits = (long)(1 << index_size) * CONTROL_SIZE;
+  int extra_levels = 1;
+
+  // Nanostore is read asynchronously (distributed ROM). A LUT6 with the
+  // MUXF7/MUXF8 of a slice covers 8 index bits, every further LUT level
+  // (4:1 multiplexer) two more.
+  if(index_size > 8)
+  {
+    extra_levels += divideRoundUp(index_size - 8, 2);
+  }
+
+  printf("\n");
+  printf("unique control words:     %d (generic g_nano_index_size => %d)\n",
+         nano_size, index_size);
+  printf("flat MPM:                 %d x %d bit = %ld bit\n",
+         MPM_SIZE, MIR_SIZE, flat_bits);
+  printf("microstore:               %d x %d bit = %ld bit\n",
+         MPM_SIZE, index_size + ADDR_SIZE, micro_bits);
+  printf("nanostore:                %d x %d bit = %ld bit\n",
+         1 << index_size, CONTROL_SIZE, nano_bits);
+  printf("two-level store:          %ld bit (%ld bit / %.1f %% saved)\n",
+         micro_bits + nano_bits, flat_bits - micro_bits - nano_bits,
+         100.0 * (flat_bits - micro_bits - nano_bits) / flat_bits);
+  printf("RAMB36 (%dK x %d):          flat %d, microstore %d\n",
+         BRAM_DEPTH / 1024, BRAM_WIDTH,
+         divideRoundUp(MPM_SIZE, BRAM_DEPTH) *
+         divideRoundUp(MIR_SIZE, BRAM_WIDTH),
+         divideRoundUp(MPM_SIZE, BRAM_DEPTH) *
+         divideRoundUp(index_size + ADDR_SIZE, BRAM_WIDTH));
+  printf("extra decode delay:       nanostore read after clk1, "
+         "%d LUT level(s)\n", extra_levels);
+  printf("\n");
+
+  printf("FINISHED!");
+  getchar();
+
+  return 0;
+}
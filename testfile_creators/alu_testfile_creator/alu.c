@@ -151,6 +151,7 @@ void alu(long in_a, long in_b, int select, long* output,
   static int z_flag = 0;
   static int v_flag = 0;
   static int c_flag = 0;
+  static long product_high = 0; // upper half of the last multiplication
 
   switch(select)
   {
@@ -260,19 +261,56 @@ void alu(long in_a, long in_b, int select, long* output,
       updateBit(output, C_POS, c_flag);
       break;
     }
-    case ALU_13:
+    case ALU_MUL: // ALUout <- lower half of ALU_A * ALU_B
     {
-      *output = ~0 & (power2(bit_size) - 1);
+      // unsigned long: the product of two 16 bit values needs 32 bit
+      unsigned long product = (unsigned long)in_a * (unsigned long)in_b;
+      *output = (long)(product & (power2(bit_size) - 1));
+      product_high = (long)(product >> bit_size);
+      n_flag = n_check(product_high, bit_size);
+      z_flag = z_check(*output | product_high);
+      v_flag = 0;
+      c_flag = (product_high != 0) ? 1 : 0;
       break;
     }
-    case ALU_14:
+    case ALU_SHIFT: // ALUout <- ALU_A shifted by ALU_B
     {
-      *output = ~0 & (power2(bit_size) - 1);
+      // the lower bits of in_b are the amount (2**shift_bits >= bit_size),
+      // the MSB of in_b is the direction (0: left, 1: right)
+      unsigned int shift_bits = 1;
+      while(power2(shift_bits) < (int)bit_size)
+      {
+        shift_bits++;
+      }
+      unsigned int amount = in_b & (power2(shift_bits) - 1);
+
+      // carry: last bit shifted out (unchanged if amount is 0)
+      if((in_b & (1 << (bit_size - 1))) == 0)
+      {
+        if(amount > 0)
+        {
+          c_flag = (amount <= bit_size) ?
+                   (in_a >> (bit_size - amount)) & 1 : 0;
+        }
+        *output = (amount < bit_size) ?
+                  (in_a << amount) & (power2(bit_size) - 1) : 0;
+      }
+      else
+      {
+        if(amount > 0)
+        {
+          c_flag = (amount <= bit_size) ? (in_a >> (amount - 1)) & 1 : 0;
+        }
+        *output = (amount < bit_size) ? in_a >> amount : 0;
+      }
+      n_flag = n_check(*output, bit_size);
+      z_flag = z_check(*output);
+      v_flag = 0;
       break;
     }
-    case ALU_15:
+    case ALU_MUL_HIGH: // ALUout <- upper half of the last product
     {
-      *output = ~0 & (power2(bit_size) - 1);
+      *output = product_high;
       break;
     }
 	  default:
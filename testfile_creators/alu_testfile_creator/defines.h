@@ -59,9 +59,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define ALU_UPDATE_NZC  10
 #define ALU_UPDATE_Z    11
 #define ALU_UPDATE_C    12
-#define ALU_13          13
-#define ALU_14          14
-#define ALU_15          15
+#define ALU_MUL         13
+#define ALU_SHIFT       14
+#define ALU_MUL_HIGH    15
 #define NO_ALU          16
 
 
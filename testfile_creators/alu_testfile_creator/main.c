@@ -57,10 +57,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define NUM_AND_SET 3
 #define NUM_ROL_SET 2
 #define NUM_ROR_SET 3
+#define NUM_MUL_SET 5
+#define NUM_SHIFT_SET 9
 
 #define NUM_PRETEST_START_SET 3
 #define NUM_PRETEST_ROL_SET 1
 #define NUM_NZVC_CHECK_SET 23
+#define NUM_MUL_HIGH_SET 12
+#define NUM_CHAINED_CARRY_SET 20
 
 
 // Performs one ALU-operation for specific inputs and select line
@@ -288,6 +292,25 @@ int main()
         FOUR, MAX,
         FIRST, FOUR
       };
+  long mul_test_set[NUM_MUL_SET * 2] =
+      { ZERO, MAX,
+        MAX, MAX,
+        ONE, FOUR,
+        FIRST, FOUR,
+        MIX, MAX_1
+      };
+  // ALU_B: amount in the lower bits, FIRST (MSB) set for a right shift
+  long shift_test_set[NUM_SHIFT_SET * 2] =
+      { MIX, ZERO,
+        MIX, ONE,
+        MAX, FOUR,
+        FIRST, ONE,
+        MAX, (long)(bit_size - 1),
+        MAX, FIRST | ONE,
+        ONE, FIRST | ONE,
+        MIX, FIRST | FOUR,
+        MAX, FIRST | (long)(bit_size - 1)
+      };
 
 
   // This pretest sets include also a select after in_a and in_b
@@ -305,6 +328,59 @@ int main()
       };
 
 
+  // every multiplication is followed by the read of the upper half and a
+  // check that the read does not change the flags
+  long mul_high_set3[NUM_MUL_HIGH_SET * 3] =
+      {
+        MAX,   MAX,   ALU_MUL,
+        ZERO,  MAX,   ALU_MUL_HIGH,
+        ZERO,  MAX,   ALU_UPDATE_NZVC,
+
+        FIRST, FOUR,  ALU_MUL,
+        ZERO,  MAX,   ALU_MUL_HIGH,
+        ZERO,  MAX,   ALU_UPDATE_NZVC,
+
+        MIX,   MAX_1, ALU_MUL,
+        ZERO,  MAX,   ALU_MUL_HIGH,
+        ZERO,  MAX,   ALU_UPDATE_NZVC,
+
+        ONE,   FOUR,  ALU_MUL,
+        ZERO,  MAX,   ALU_MUL_HIGH,
+        ZERO,  MAX,   ALU_UPDATE_NZVC
+      };
+
+  // 16 bit operations of the microcode (two bus sizes): the carry is set
+  // before, the lower half is added, the upper half uses the carry of the
+  // lower half, the flags of the upper half are checked at the end;
+  // the compare adds the negated operand with C = 1
+  long chained_carry_set3[NUM_CHAINED_CARRY_SET * 3] =
+      {
+        ZERO,        ZERO,          ALU_C0,
+        ONE,         MAX,           ALU_ADD,
+        ZERO,        ZERO,          ALU_ADD,
+        ZERO,        MAX,           ALU_UPDATE_NZVC,
+
+        ZERO,        ZERO,          ALU_C0,
+        MAX,         ONE,           ALU_ADD,
+        MAX,         ZERO,          ALU_ADD,
+        ZERO,        MAX,           ALU_UPDATE_NZVC,
+
+        ZERO,        ZERO,          ALU_C0,
+        MAX,         ONE,           ALU_ADD,
+        MAX ^ FIRST, ZERO,          ALU_ADD,
+        ZERO,        MAX,           ALU_UPDATE_NZVC,
+
+        ZERO,        ZERO,          ALU_C1,
+        MIX,         MAX ^ MIX,     ALU_ADD,
+        FIRST,       MAX ^ FIRST,   ALU_ADD,
+        ZERO,        MAX,           ALU_UPDATE_NZVC,
+
+        ZERO,        ZERO,          ALU_C1,
+        ZERO,        MAX_1,         ALU_ADD,
+        ONE,         MAX_1,         ALU_ADD,
+        ZERO,        MAX,           ALU_UPDATE_NZVC
+      };
+
   long NZVC_check_set3[NUM_NZVC_CHECK_SET * 3] =
       {
         ZERO,  MAX,  ALU_UPDATE_NZVC,
@@ -440,25 +516,32 @@ int main()
 
   if(print_output == ENABLE)
   {
-    printf("ALU 13:\n");
+    printf("ALU MULTIPLICATION:\n");
   }
-  performFixedTest(standard_test_set, NUM_STANDARD_SET, ALU_13, bit_size,
+  performFixedTest(mul_test_set, NUM_MUL_SET, ALU_MUL, bit_size,
       &error_status, print_output, fp, MIX, MAX);
 
   if(print_output == ENABLE)
   {
-    printf("ALU 14:\n");
+    printf("ALU MULTIPLICATION UPPER HALF:\n");
   }
-  performFixedTest(standard_test_set, NUM_STANDARD_SET, ALU_14, bit_size,
-      &error_status, print_output, fp, MIX, MAX);
+  performTests(mul_high_set3, NUM_MUL_HIGH_SET, bit_size,
+      &error_status, print_output, fp);
 
   if(print_output == ENABLE)
   {
-    printf("ALU 15:\n");
+    printf("ALU SHIFT:\n");
   }
-  performFixedTest(standard_test_set, NUM_STANDARD_SET, ALU_15, bit_size,
+  performFixedTest(shift_test_set, NUM_SHIFT_SET, ALU_SHIFT, bit_size,
       &error_status, print_output, fp, MIX, MAX);
 
+  if(print_output == ENABLE)
+  {
+    printf("ALU CHAINED CARRY (16 BIT ADDITION/COMPARE):\n");
+  }
+  performTests(chained_carry_set3, NUM_CHAINED_CARRY_SET, bit_size,
+      &error_status, print_output, fp);
+
   //error check only after all fixed tests performed
   if(error_status != NO_ERROR)
   {
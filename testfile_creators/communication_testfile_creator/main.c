@@ -55,6 +55,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define ADDRESS_RANGE 65536
 #define NUM_RANGE 256
+#define QUEUE_DEPTH 4 // has to be equal to the generic g_queue_depth
 
 
 int main()
@@ -199,9 +200,16 @@ int main()
   uint16_t addr = 0;
   uint16_t mar_reg = 0;
 
+  // prefetch queue (only the address and the number of bytes are needed, as
+  // a write clears the queue and the bytes are always equal to the memory)
+  uint16_t queue_address = 0;
+  int queue_count = 0;
+  int queue_active = 0;
+  uint16_t check_addr = 0;
+
   for(counter = 0; counter < iteration_number; counter++)
   {
-    rd_wr = rand() % 3;
+    rd_wr = rand() % 6;
 
     if(rd_wr == 0) // READ OPERATION
     {
@@ -239,6 +247,7 @@ int main()
 
       fprintf(fp_input, "1001 %02X %5u %5u %02X\n", alu_out, addr,
         mar_reg, mbr_reg);
+      queue_count = 0;
 
       alu_out = (uint8_t)(rand() % NUM_RANGE);
       addr = (uint16_t)(rand() % ADDRESS_RANGE);
@@ -246,20 +255,117 @@ int main()
 
       fprintf(fp_input, "0001 %02X %5u %5u %02X\n", alu_out, addr,
         mar_reg, mbr_reg);
+      queue_count = 0;
 
       if(print_output == ENABLE)
       {
         printf("WRITE %02X from MBR to MEM[%u]\n", mbr_reg, mar_reg);
       }
     }
-    else // no_operation
+    else if(rd_wr == 2) // TAKE NEXT BYTE
+    {
+      alu_out = (uint8_t)(rand() % NUM_RANGE);
+      if(queue_active == 1 && (rand() % 4) != 0)
+      {
+        addr = queue_address; // mostly the next byte
+      }
+      else
+      {
+        addr = (uint16_t)(rand() % ADDRESS_RANGE); // jump
+      }
+      mar_reg = addr;
+      mbr_reg = memory[mar_reg];
+
+      fprintf(fp_input, "1110 %02X %5u %5u %02X TAKE\n", alu_out, addr,
+        mar_reg, mbr_reg);
+
+      if(print_output == ENABLE)
+      {
+        printf("TAKE  %02X from MEM[%u] to MBR (%s)\n", mbr_reg, mar_reg,
+          (queue_count > 0 && queue_address == addr) ? "queue" : "RAM");
+      }
+
+      if(queue_count > 0 && queue_address == addr)
+      {
+        queue_count--;
+      }
+      else
+      {
+        queue_count = 0;
+      }
+      queue_address = (uint16_t)(addr + 1);
+      queue_active = 1;
+    }
+    else if(rd_wr == 3) // READ NEXT BYTE (MAR <- MAR + 1, then read)
     {
       alu_out = (uint8_t)(rand() % NUM_RANGE);
       addr = (uint16_t)(rand() % ADDRESS_RANGE);
+      mar_reg = (uint16_t)(mar_reg + 1);
 
-      fprintf(fp_input, "0000 %02X %5u %5u %02X NOP\n", alu_out, addr,
+      fprintf(fp_input, "0010 %02X %5u %5u %02X INC\n", alu_out, addr,
+        mar_reg, mbr_reg);
+
+      alu_out = (uint8_t)(rand() % NUM_RANGE);
+      addr = (uint16_t)(rand() % ADDRESS_RANGE);
+      mbr_reg = memory[mar_reg];
+
+      fprintf(fp_input, "1010 %02X %5u %5u %02X\n", alu_out, addr,
         mar_reg, mbr_reg);
 
+      if(print_output == ENABLE)
+      {
+        printf("READ  %02X from MEM[%u] to MBR (MAR + 1)\n", memory[mar_reg],
+          mar_reg);
+      }
+    }
+    else if(rd_wr == 4) // WRITE PREVIOUS BYTE (MAR <- MAR - 1, then write)
+    {
+      alu_out = (uint8_t)(rand() % NUM_RANGE);
+      addr = (uint16_t)(rand() % ADDRESS_RANGE);
+      mar_reg = (uint16_t)(mar_reg - 1);
+
+      fprintf(fp_input, "0011 %02X %5u %5u %02X DEC\n", alu_out, addr,
+        mar_reg, mbr_reg);
+
+      alu_out = (uint8_t)(rand() % NUM_RANGE);
+      addr = (uint16_t)(rand() % ADDRESS_RANGE);
+      mbr_reg = alu_out;
+
+      fprintf(fp_input, "1001 %02X %5u %5u %02X\n", alu_out, addr,
+        mar_reg, mbr_reg);
+      queue_count = 0;
+
+      alu_out = (uint8_t)(rand() % NUM_RANGE);
+      addr = (uint16_t)(rand() % ADDRESS_RANGE);
+      memory[mar_reg] = mbr_reg;
+
+      fprintf(fp_input, "0001 %02X %5u %5u %02X\n", alu_out, addr,
+        mar_reg, mbr_reg);
+      queue_count = 0;
+
+      if(print_output == ENABLE)
+      {
+        printf("WRITE %02X from MBR to MEM[%u] (MAR - 1)\n", mbr_reg, mar_reg);
+      }
+    }
+    else // no_operation (prefetch queue reads next byte)
+    {
+      alu_out = (uint8_t)(rand() % NUM_RANGE);
+      addr = (uint16_t)(rand() % ADDRESS_RANGE);
+
+      if(queue_active == 1 && queue_count < QUEUE_DEPTH)
+      {
+        check_addr = (uint16_t)(queue_address + queue_count);
+        queue_count++;
+      }
+      else
+      {
+        check_addr = mar_reg;
+      }
+
+      fprintf(fp_input, "0000 %02X %5u %5u %02X NOP\n", alu_out, addr,
+        check_addr, mbr_reg);
+
       if(print_output == ENABLE)
       {
         printf("NOP\n");
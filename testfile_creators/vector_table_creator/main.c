@@ -0,0 +1,181 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2018, Bernhard Vacarescu
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FILE_OPEN_ERROR 1
+#define FILE_WRITE_ERROR 2
+
+#define MAX_INT_LINES 62 // vector address (event number * 4) has to fit into
+                         // EARL (8 bit)
+#define VECTOR_SIZE 4    // words per vector (JMP, HI, LO, unused)
+#define OPCODE_JMP 0x7E
+#define OPCODE_RTI 0x3B
+
+#define OUTPUT_FILENAME "VECTOR_TABLE.txt"
+
+#define LINE_SIZE 32 // Max. string length: LINE_SIZE - 1 ('0' byte).
+                     // In program max. length of LINE_SIZE - 2 used.
+                     // Length of LINE_SIZE - 1 used to check if too long.
+
+void readLine(char* line, int size);
+void vectorName(int vector, char* name);
+
+
+// Reads one line from stdin (the rest of a too long line is removed).
+void readLine(char* line, int size)
+{
+  if(fgets(line, size, stdin) == NULL)
+  {
+    line[0] = '\0';
+    return;
+  }
+  if(line[strlen(line) - 1] != '\n')
+  {
+    // flush stdin
+    // never considers EOF
+    while(getchar() != '\n');
+  }
+}
+
+
+// Name of a vector: RESET (0), SWI (1), INTn (n + 1).
+void vectorName(int vector, char* name)
+{
+  if(vector == 0)
+  {
+    strcpy(name, "RESET");
+  }
+  else if(vector == 1)
+  {
+    strcpy(name, "SWI");
+  }
+  else
+  {
+    sprintf(name, "INT%d", vector - 1);
+  }
+}
+
+
+int main()
+{
+  int int_lines = 0;
+  int bit_size = 0;
+  int digits = 0;
+  int vector = 0;
+  int counter = 0;
+  unsigned long address = 0;
+  unsigned long mask = 0;
+  int used = 0;
+  char line[LINE_SIZE];
+  char name[LINE_SIZE];
+
+  // Get arguments from stdin
+  while(int_lines < 1 || int_lines > MAX_INT_LINES)
+  {
+    printf("Enter number of interrupt lines (1-%d): ", MAX_INT_LINES);
+    readLine(line, sizeof(line));
+    sscanf(line, "%d", &int_lines); //sscanf not reads \n left from fgets
+  }
+  while(bit_size != 8 && bit_size != 16)
+  {
+    printf("Enter bit size of the processor (8 or 16): ");
+    readLine(line, sizeof(line));
+    sscanf(line, "%d", &bit_size);
+  }
+  digits = bit_size / 4;
+  mask = (bit_size == 8) ? 0xFFUL : 0xFFFFUL;
+
+
+  FILE* fp;
+  fp = fopen(OUTPUT_FILENAME, "w");
+  if(fp == NULL)
+  {
+    printf("Could not open file!");
+    getchar();
+    return FILE_OPEN_ERROR;
+  }
+
+  printf("Enter the address of every routine in hexadecimal format, an empty\n"
+         "line for an unused vector (RTI).\n");
+
+  for(vector = 0; vector < int_lines + 2; vector++)
+  {
+    vectorName(vector, name);
+    do
+    {
+      printf("%s: ", name);
+      readLine(line, sizeof(line));
+      used = (sscanf(line, "%lx", &address) == 1);
+    }while(used == 0 && vector == 0); // the reset vector is always needed
+
+    if(used)
+    {
+      fprintf(fp, "%0*lX        JMP %s\n", digits, (unsigned long)OPCODE_JMP,
+              name);
+      fprintf(fp, "%0*lX\n", digits, (address >> bit_size) & mask);
+      fprintf(fp, "%0*lX\n", digits, address & mask);
+    }
+    else
+    {
+      fprintf(fp, "%0*lX        RTI %s (unused)\n", digits,
+              (unsigned long)OPCODE_RTI, name);
+      for(counter = 1; counter < VECTOR_SIZE - 1; counter++)
+      {
+        fprintf(fp, "%0*X\n", digits, 0);
+      }
+    }
+    fprintf(fp, "%0*X\n", digits, 0);
+  }
+
+  if(ferror(fp))
+  {
+    printf("Error writing file!");
+    fclose(fp);
+    getchar();
+    return FILE_WRITE_ERROR;
+  }
+  fclose(fp);
+
+  printf("Vector table (%d words, addresses 0 to %d) written to \"%s\".\n",
+         VECTOR_SIZE * (int_lines + 2), VECTOR_SIZE * (int_lines + 2) - 1,
+         OUTPUT_FILENAME);
+  printf("The processor (generic g_interrupt_line_size) and the testbench\n"
+         "(constant c_interrupt_lines) have to use %d interrupt lines.\n",
+         int_lines);
+  getchar();
+
+  return 0;
+}
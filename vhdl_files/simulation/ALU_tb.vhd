@@ -36,6 +36,8 @@
 -- the inputs and how the output should look like. The output of the file
 -- is compared with the output of the design.
 -- In the first line of the file there is an integer indicating the bus size.
+-- It has to match c_bus_size, which is 8 for the processor and can be set to 16
+-- to test the ALU of the 16 bit variant (with a file created for 16 bit).
 ----------------------------------------------------------------------------------
 
 library IEEE;
@@ -83,7 +85,11 @@ architecture testbench of ALU_tb is
           o_Z_FLAG : out STD_LOGIC;
           o_N_FLAG : out STD_LOGIC;
           o_V_FLAG : out STD_LOGIC;
-          o_C_FLAG : out STD_LOGIC 
+          o_C_FLAG : out STD_LOGIC;
+          o_Z_NEXT : out STD_LOGIC;
+          o_N_NEXT : out STD_LOGIC;
+          o_V_NEXT : out STD_LOGIC;
+          o_C_NEXT : out STD_LOGIC
         );
     end component;
 
@@ -35,8 +35,9 @@
 -- Checks the correct operation of the Communication (MBR, MAR) using textfiles.
 -- The file ending with _MEM_IN.txt contains the contents of the connected RAM
 -- at the beginning of the test.
--- The file ending with _INPUT.txt contains the read or write commands that 
--- should be performed.
+-- The file ending with _INPUT.txt contains the read, write or take commands 
+-- that should be performed. The address check also covers the reads of the
+-- prefetch queue (queue depth has to fit to the file creator).
 -- The file ending with _MEM_OUT.txt contains the content of the connected RAM
 -- after all operations.
 ----------------------------------------------------------------------------------
@@ -68,7 +69,8 @@ use work.functions.all;
 
 entity Communication_tb is
   Generic (
-    g_bit : POSITIVE := 8
+    g_bit : POSITIVE := 8;
+    g_queue_depth : NATURAL := 4 -- QUEUE_DEPTH of the file creator
   );
 end Communication_tb;
 
@@ -78,7 +80,8 @@ architecture testbench of Communication_tb is
 
     component Communication
       Generic ( 
-        g_bit : POSITIVE
+        g_bit : POSITIVE;
+        g_queue_depth : NATURAL
       );
       Port ( 
         i_CLK_MAR : in STD_LOGIC; -- CLK3
@@ -89,6 +92,8 @@ architecture testbench of Communication_tb is
         i_B_REG : in STD_LOGIC_VECTOR (g_bit-1 downto 0); -- laoded into MAR H
         o_DATA_TO_AMUX : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
         o_ADDRESS : out STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+        o_QUEUE_RD : out STD_LOGIC;
+        o_QUEUE_HIT : out STD_LOGIC;
         io_DATA_MEM : inout STD_LOGIC_VECTOR (g_bit-1 downto 0) -- from/to RAM
       );
     end component;
@@ -102,11 +107,12 @@ architecture testbench of Communication_tb is
     signal r_B_REG : STD_LOGIC_VECTOR (g_bit-1 downto 0) := (others => '0');
     signal w_mbr_content : STD_LOGIC_VECTOR (g_bit-1 downto 0);
     signal w_address : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+    signal w_queue_rd : STD_LOGIC;
     signal rw_DATA_MEM : STD_LOGIC_VECTOR (g_bit-1 downto 0) := (others => 'Z');
     
     signal r_RAM : t_RAM (0 to 2**(2*g_bit)-1) := 
         initRam("..\..\..\Testbench_Files\Communication\" & 
-        c_filename_mem_in, 2**(2*g_bit)-1);
+        c_filename_mem_in, 2**(2*g_bit)-1, g_bit);
 
     file file_input : TEXT; 
     file file_mem_out : TEXT;
@@ -121,7 +127,8 @@ begin
 
     uut: Communication
       generic map ( 
-        g_bit => g_bit
+        g_bit => g_bit,
+        g_queue_depth => g_queue_depth
       )
       port map ( 
         i_CLK_MAR => r_CLK_MAR,
@@ -132,6 +139,8 @@ begin
         i_B_REG => r_B_REG,
         o_DATA_TO_AMUX => w_mbr_content,
         o_ADDRESS => w_address,
+        o_QUEUE_RD => w_queue_rd,
+        o_QUEUE_HIT => open,
         io_DATA_MEM => rw_DATA_MEM
       );
                          
@@ -223,7 +232,7 @@ begin
         readline(file_mem_out, v_line_pointer_read);
         hread(v_line_pointer_read, v_memory_block);
         
-        assert(v_memory_block = r_RAM(j))
+        assert(v_memory_block = r_RAM(j)(g_bit-1 downto 0))
         report("Wrong contnet at RAM location " & integer'image(j))
         severity failure;
       end loop;
@@ -238,12 +247,13 @@ begin
     end process PROC_stim;
     
     -- imitates an external asynchronous RAM (not clocked)
-    PROC_memory: process (r_CONTROL, r_RAM, rw_DATA_MEM, init_finished)
+    PROC_memory: process (r_CONTROL, r_RAM, rw_DATA_MEM, init_finished, 
+        w_address, w_queue_rd)
     begin   
-      if r_CONTROL(1) = '1' then -- RD
-        rw_DATA_MEM <=  r_RAM(to_integer(unsigned((w_address))));
+      if (r_CONTROL(1) = '1') OR (w_queue_rd = '1') then -- RD
+        rw_DATA_MEM <=  r_RAM(to_integer(unsigned((w_address))))(g_bit-1 downto 0);
       elsif r_CONTROL(0) = '1' then -- WR
-        r_RAM(to_integer(unsigned((w_address)))) <= rw_DATA_MEM;
+        r_RAM(to_integer(unsigned((w_address))))(g_bit-1 downto 0) <= rw_DATA_MEM;
         rw_DATA_MEM <= (others => 'Z');
       else
         rw_DATA_MEM <= (others => 'Z');
@@ -0,0 +1,241 @@
+-- BSD 3-Clause License
+-- 
+-- Copyright (c) 2018, Bernhard Vacarescu
+-- All rights reserved.
+-- 
+-- Redistribution and use in source and binary forms, with or without
+-- modification, are permitted provided that the following conditions are met:
+-- 
+-- * Redistributions of source code must retain the above copyright notice, this
+--   list of conditions and the following disclaimer.
+-- 
+-- * Redistributions in binary form must reproduce the above copyright notice,
+--   this list of conditions and the following disclaimer in the documentation
+--   and/or other materials provided with the distribution.
+-- 
+-- * Neither the name of the copyright holder nor the names of its
+--   contributors may be used to endorse or promote products derived from
+--   this software without specific prior written permission.
+-- 
+-- THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+-- AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+-- IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+-- DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+-- FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+-- DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+-- SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+-- CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+-- OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+-- OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+----------------------------------------------------------------------------------
+-- DMA TESTBENCH
+----------------------------------------------------------------------------------
+-- Connects the DMA to a synchronous RAM (like in "Processor_Controller") and
+-- imitates a processor that accesses the RAM in every second memory cycle 
+-- (RD). Copies 16 bytes from 0x0010 to 0x0040 and checks:
+--    - the destination block and that the word behind it is unchanged
+--    - the interrupt pulse and the done flag
+--    - the number of memory cycles (2 free cycles per byte, so 4 cycles per 
+--      byte with the accesses of the processor)
+--    - the registers at the end (SRC and DST behind the blocks, LEN 0)
+----------------------------------------------------------------------------------
+
+library IEEE;
+use IEEE.STD_LOGIC_1164.ALL;
+use IEEE.NUMERIC_STD.ALL;
+
+library work;
+use work.datatypes.all;
+
+
+entity DMA_tb is
+    Generic (
+      g_clock_period : TIME := 10 ns
+    );  
+end DMA_tb;
+
+architecture testbench of DMA_tb is
+
+    component DMA
+      Generic ( 
+        g_bit : POSITIVE := 8;
+        g_base_address : NATURAL := 16#FE08#
+      );
+      Port ( 
+        i_CLK : in STD_LOGIC;
+        i_ADDRESS : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+        i_DATA : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        i_RD : in STD_LOGIC;
+        i_WR : in STD_LOGIC;
+        o_DATA : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        o_SELECTED : out STD_LOGIC;
+        i_RAM_DATA : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        o_RAM_ADDRESS : out STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+        o_RAM_DATA : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        o_RAM_ENABLE : out STD_LOGIC;
+        o_RAM_WRITE : out STD_LOGIC;
+        o_INTERRUPT : out STD_LOGIC
+      );
+    end component;
+
+    signal r_CLK : STD_LOGIC := '0';
+    signal r_ADDRESS : STD_LOGIC_VECTOR (15 downto 0) := (others => '0');
+    signal r_DATA : STD_LOGIC_VECTOR (7 downto 0) := (others => '0');
+    signal r_RD : STD_LOGIC := '0';
+    signal r_WR : STD_LOGIC := '0';
+    signal w_data : STD_LOGIC_VECTOR (7 downto 0);
+    signal w_selected : STD_LOGIC;
+    signal w_interrupt : STD_LOGIC;
+    
+    signal w_ram_address : STD_LOGIC_VECTOR (15 downto 0);
+    signal w_dma_address : STD_LOGIC_VECTOR (15 downto 0);
+    signal w_dma_data : STD_LOGIC_VECTOR (7 downto 0);
+    signal w_dma_enable : STD_LOGIC;
+    signal w_dma_write : STD_LOGIC;
+    signal r_RAM_DATA : STD_LOGIC_VECTOR (7 downto 0) := (others => '0');
+    
+    -- RAM: byte at address n is n + 1
+    function initRamCount return t_RAM is
+      variable v_ram : t_RAM (0 to 255);
+    begin
+      for i in 0 to 255 loop
+        v_ram(i) := (others => '0');
+        v_ram(i)(7 downto 0) := STD_LOGIC_VECTOR(to_unsigned((i + 1) mod 256, 8));
+      end loop;
+      return v_ram;
+    end function;
+    
+    signal r_RAM : t_RAM (0 to 255) := initRamCount;
+    
+    -- processor imitation: RD in every second memory cycle
+    signal r_PROCESSOR_RD : BOOLEAN := FALSE;
+
+    signal stop_the_clock : BOOLEAN := FALSE;
+
+begin
+
+    uut: DMA 
+      port map ( 
+        i_CLK => r_CLK,
+        i_ADDRESS => r_ADDRESS,
+        i_DATA => r_DATA,
+        i_RD => r_RD,
+        i_WR => r_WR,
+        o_DATA => w_data,
+        o_SELECTED => w_selected,
+        i_RAM_DATA => r_RAM_DATA,
+        o_RAM_ADDRESS => w_dma_address,
+        o_RAM_DATA => w_dma_data,
+        o_RAM_ENABLE => w_dma_enable,
+        o_RAM_WRITE => w_dma_write,
+        o_INTERRUPT => w_interrupt
+      );
+      
+    w_ram_address <= w_dma_address when w_dma_enable = '1' else r_ADDRESS;
+
+    PROC_ram: process (r_CLK)
+    begin
+      if rising_edge(r_CLK) then
+        if w_dma_write = '1' then
+          r_RAM(to_integer(UNSIGNED(w_dma_address(7 downto 0))))(7 downto 0) 
+              <= w_dma_data;
+        end if;
+        r_RAM_DATA <= 
+            r_RAM(to_integer(UNSIGNED(w_ram_address(7 downto 0))))(7 downto 0);
+      end if;
+    end process PROC_ram;
+
+
+    PROC_stim: process
+      variable v_cycles : NATURAL;
+      
+      procedure writeRegister(address : in NATURAL; data : in NATURAL) is
+      begin
+        wait until falling_edge(r_CLK);
+        r_ADDRESS <= STD_LOGIC_VECTOR(to_unsigned(address, 16));
+        r_DATA <= STD_LOGIC_VECTOR(to_unsigned(data, 8));
+        r_WR <= '1';
+        wait until falling_edge(r_CLK);
+        r_WR <= '0';
+      end procedure;
+      
+      procedure checkRegister(address : in NATURAL; data : in NATURAL) is
+      begin
+        r_ADDRESS <= STD_LOGIC_VECTOR(to_unsigned(address, 16));
+        wait for 1 ns;
+        assert(w_data = STD_LOGIC_VECTOR(to_unsigned(data, 8)))
+        report("Wrong content of DMA register " & integer'image(address))
+        severity error;
+      end procedure;
+      
+    begin
+      writeRegister(16#FE09#, 16#00#);
+      writeRegister(16#FE0A#, 16#10#);
+      writeRegister(16#FE0B#, 16#00#);
+      writeRegister(16#FE0C#, 16#40#);
+      writeRegister(16#FE0D#, 16#00#);
+      writeRegister(16#FE0E#, 16#10#);
+      checkRegister(16#FE0E#, 16#10#);
+      
+      -- start with interrupt, the processor reads the RAM at 0x0000
+      writeRegister(16#FE08#, 16#05#);
+      r_ADDRESS <= x"0000";
+      r_PROCESSOR_RD <= TRUE;
+      v_cycles := 0;
+      loop
+        wait until rising_edge(r_CLK);
+        wait for 1 ns;
+        v_cycles := v_cycles + 1;
+        exit when w_interrupt = '1';
+      end loop;
+      r_PROCESSOR_RD <= FALSE;
+      report("DMA finished after " & integer'image(v_cycles) & " cycles");
+      assert(v_cycles <= 4*16 + 2)
+      report("DMA too slow") severity error;
+      
+      for i in 0 to 15 loop
+        assert(UNSIGNED(r_RAM(16#40# + i)(7 downto 0)) = 16#11# + i)
+        report("Wrong copy at " & integer'image(16#40# + i)) severity error;
+      end loop;
+      assert(UNSIGNED(r_RAM(16#50#)(7 downto 0)) = 16#51#)
+      report("Word behind the block written") severity error;
+      
+      checkRegister(16#FE08#, 16#84#); -- done, not busy
+      checkRegister(16#FE0A#, 16#20#);
+      checkRegister(16#FE0C#, 16#50#);
+      checkRegister(16#FE0E#, 16#00#);
+      writeRegister(16#FE08#, 16#00#);
+      checkRegister(16#FE08#, 16#00#); -- flag cleared
+      
+      report("DMA test finished!");
+      stop_the_clock <= TRUE;
+      wait;
+    end process PROC_stim;
+    
+    
+    PROC_processor: process (r_CLK)
+    begin
+      if rising_edge(r_CLK) then
+        if r_PROCESSOR_RD AND r_RD = '0' then
+          r_RD <= '1';
+        else
+          r_RD <= '0';
+        end if;
+      end if;
+    end process PROC_processor;
+
+
+    PROC_clk: process
+    begin
+      while not stop_the_clock loop
+        r_CLK <= '0';
+        wait for g_clock_period/2;
+        r_CLK <= '1';
+        wait for g_clock_period/2;
+      end loop;
+      wait;
+    end process PROC_clk;
+
+end architecture;
@@ -56,6 +56,7 @@ architecture testbench of Debouncer_tb is
         Port ( 
           i_IN : in STD_LOGIC;
           i_CLK : in STD_LOGIC;
+          i_TICK : in STD_LOGIC := '1';
           o_OUT : out STD_LOGIC
         );
     end component;
@@ -66,6 +66,7 @@ architecture testbench of EventController_tb is
         i_RESET : in STD_LOGIC;
         i_CLK : in STD_LOGIC;
         i_INTERRUPT : in STD_LOGIC_VECTOR (1 to g_int_lines);
+        o_INTERRUPT : out STD_LOGIC_VECTOR (1 to g_int_lines);
         o_event_control : out STD_LOGIC_VECTOR (g_bit_size-1 downto 0) 
       );
     end component;
@@ -73,6 +74,7 @@ architecture testbench of EventController_tb is
     signal r_RESET : STD_LOGIC;
     signal r_INTERRUPT : STD_LOGIC_VECTOR (1 to g_int_lines);
     signal r_CLK : STD_LOGIC;
+    signal w_interrupt : STD_LOGIC_VECTOR (1 to g_int_lines);
     signal w_event_control : STD_LOGIC_VECTOR (g_bit_size-1 downto 0);
     
     signal stop_the_clock: BOOLEAN;
@@ -89,6 +91,7 @@ begin
       i_RESET => r_RESET, 
       i_CLK => r_CLK,
       i_INTERRUPT => r_INTERRUPT,
+      o_INTERRUPT => w_interrupt,
       o_event_control =>  w_event_control
     );
 
@@ -0,0 +1,280 @@
+-- BSD 3-Clause License
+-- 
+-- Copyright (c) 2018, Bernhard Vacarescu
+-- All rights reserved.
+-- 
+-- Redistribution and use in source and binary forms, with or without
+-- modification, are permitted provided that the following conditions are met:
+-- 
+-- * Redistributions of source code must retain the above copyright notice, this
+--   list of conditions and the following disclaimer.
+-- 
+-- * Redistributions in binary form must reproduce the above copyright notice,
+--   this list of conditions and the following disclaimer in the documentation
+--   and/or other materials provided with the distribution.
+-- 
+-- * Neither the name of the copyright holder nor the names of its
+--   contributors may be used to endorse or promote products derived from
+--   this software without specific prior written permission.
+-- 
+-- THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+-- AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+-- IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+-- DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+-- FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+-- DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+-- SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+-- CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+-- OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+-- OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------------
+-- INTERRUPT CONTROLLER TESTBENCH
+----------------------------------------------------------------------------------
+-- Tests the interrupt controller with eight interrupt lines and a bus size of
+-- 8 bit (self-checking, reports an error for a wrong output):
+--    - reset: no pending line, all lines enabled with priority 7
+--    - the lower line wins for the same priority, a higher priority wins
+--      independent of the line number, the level masks all lines with a 
+--      priority that is not higher
+--    - ICTRL (enable, pending, priority) and IENTRY (CC of the routine)
+--    - acknowledge of the served line (o_TAKEN only for a line), a request 
+--      at the same clock edge is not lost
+----------------------------------------------------------------------------------
+
+library IEEE;
+use IEEE.STD_LOGIC_1164.ALL;
+use IEEE.NUMERIC_STD.ALL;
+
+
+entity InterruptController_tb is
+  Generic( 
+    g_clock_period : TIME := 100 ns; -- 10 MHz
+    g_bit : positive := 8;
+    g_int_lines : positive := 8 
+  );
+end InterruptController_tb;
+
+
+
+architecture testbench of InterruptController_tb is
+
+    component Interrupt_Controller
+      Generic ( 
+        g_bit : positive;
+        g_int_lines : positive
+      );
+      Port ( 
+        i_CLK : in STD_LOGIC;
+        i_RESET : in STD_LOGIC;
+        i_INTERRUPT : in STD_LOGIC_VECTOR (1 to g_int_lines);
+        i_LEVEL : in STD_LOGIC_VECTOR (2 downto 0);
+        i_WR_SEL : in STD_LOGIC;
+        i_WR_CTRL : in STD_LOGIC;
+        i_DATA : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        i_ACK : in STD_LOGIC;
+        i_SERVED : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        o_SEL : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        o_CTRL : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        o_ENTRY_CC : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        o_TAKEN : out STD_LOGIC;
+        o_EVENT_CONTROL : out STD_LOGIC_VECTOR (g_bit-1 downto 0) 
+      );
+    end component;
+
+    signal r_CLK : STD_LOGIC := '0';
+    signal r_RESET : STD_LOGIC := '0';
+    signal r_INTERRUPT : STD_LOGIC_VECTOR (1 to g_int_lines) 
+        := (others => '0');
+    signal r_LEVEL : STD_LOGIC_VECTOR (2 downto 0) := "000";
+    signal r_WR_SEL : STD_LOGIC := '0';
+    signal r_WR_CTRL : STD_LOGIC := '0';
+    signal r_DATA : STD_LOGIC_VECTOR (g_bit-1 downto 0) := (others => '0');
+    signal r_ACK : STD_LOGIC := '0';
+    signal r_SERVED : STD_LOGIC_VECTOR (g_bit-1 downto 0) := (others => '0');
+    signal w_sel : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_ctrl : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_entry_cc : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_taken : STD_LOGIC;
+    signal w_event_control : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    
+    signal stop_the_clock: BOOLEAN;
+    
+    -- no event status (only MSB set)
+    constant c_no_event : STD_LOGIC_VECTOR (g_bit-1 downto 0) 
+        := (g_bit-1 => '1', others => '0');
+    
+begin
+
+  uut: Interrupt_Controller 
+    generic map ( 
+      g_bit => g_bit, 
+      g_int_lines => g_int_lines 
+    ) 
+    port map ( 
+      i_CLK => r_CLK,
+      i_RESET => r_RESET, 
+      i_INTERRUPT => r_INTERRUPT,
+      i_LEVEL => r_LEVEL,
+      i_WR_SEL => r_WR_SEL,
+      i_WR_CTRL => r_WR_CTRL,
+      i_DATA => r_DATA,
+      i_ACK => r_ACK,
+      i_SERVED => r_SERVED,
+      o_SEL => w_sel,
+      o_CTRL => w_ctrl,
+      o_ENTRY_CC => w_entry_cc,
+      o_TAKEN => w_taken,
+      o_EVENT_CONTROL => w_event_control
+    );
+
+
+  PROC_stim: process
+  
+    -- inputs are changed in the middle of the clock period, so one call 
+    -- contains exactly one rising edge
+    procedure clock_cycle is
+    begin
+      wait until falling_edge(r_CLK);
+    end procedure;
+    
+    procedure request (line_nr : in positive) is
+    begin
+      r_INTERRUPT(line_nr) <= '1';
+      clock_cycle;
+      r_INTERRUPT(line_nr) <= '0';
+    end procedure;
+    
+    procedure write_ctrl (line_nr : in natural; value : in natural) is
+    begin
+      r_DATA <= STD_LOGIC_VECTOR(to_unsigned(line_nr, g_bit));
+      r_WR_SEL <= '1';
+      clock_cycle;
+      r_WR_SEL <= '0';
+      r_DATA <= STD_LOGIC_VECTOR(to_unsigned(value, g_bit));
+      r_WR_CTRL <= '1';
+      clock_cycle;
+      r_WR_CTRL <= '0';
+    end procedure;
+    
+    procedure check_event (expected : in STD_LOGIC_VECTOR; text : in STRING) is
+    begin
+      wait for 1 ns;
+      assert w_event_control = expected
+      report "Wrong event (" & text & "): " & 
+          integer'image(to_integer(UNSIGNED(w_event_control)))
+      severity error;
+    end procedure;
+    
+    function event_of (line_nr : positive) return STD_LOGIC_VECTOR is
+    begin
+      return STD_LOGIC_VECTOR(to_unsigned(line_nr + 1, g_bit));
+    end function;
+    
+  begin
+    report "Validation starts...";
+    clock_cycle;
+    
+    r_RESET <= '1';
+    clock_cycle;
+    r_RESET <= '0';
+    check_event(c_no_event, "after reset");
+    
+    -- same priority: the lower line wins
+    request(5);
+    check_event(event_of(5), "line 5");
+    request(3);
+    check_event(event_of(3), "lines 3 and 5");
+    r_LEVEL <= "111";
+    check_event(c_no_event, "level 7");
+    
+    -- line 3: priority 2 (pending bit written with 1)
+    r_LEVEL <= "000";
+    write_ctrl(3, 16#C2#);
+    check_event(event_of(5), "line 3 with priority 2");
+    assert w_ctrl = x"C2" report "Wrong ICTRL of line 3" severity error;
+    assert UNSIGNED(w_sel) = 3 report "Wrong ISEL" severity error;
+    r_LEVEL <= "010";
+    check_event(event_of(5), "level 2");
+    
+    -- IENTRY: priority of the served line in bits 7 to 5, SWI (event 1)
+    r_SERVED <= event_of(3);
+    wait for 1 ns;
+    assert w_entry_cc = x"5F" report "Wrong IENTRY of line 3" severity error;
+    r_SERVED <= STD_LOGIC_VECTOR(to_unsigned(1, g_bit));
+    wait for 1 ns;
+    assert w_entry_cc = x"FF" report "Wrong IENTRY of SWI" severity error;
+    r_ACK <= '1';
+    wait for 1 ns;
+    assert w_taken = '0' report "SWI taken" severity error;
+    r_ACK <= '0';
+    
+    -- acknowledge line 5
+    r_SERVED <= event_of(5);
+    r_ACK <= '1';
+    wait for 1 ns;
+    assert w_taken = '1' report "Line 5 not taken" severity error;
+    clock_cycle;
+    r_ACK <= '0';
+    check_event(c_no_event, "level 2, line 5 served");
+    r_LEVEL <= "001";
+    check_event(event_of(3), "level 1, line 5 served");
+    
+    -- disabled line stays pending
+    r_LEVEL <= "000";
+    write_ctrl(3, 16#42#);
+    check_event(c_no_event, "line 3 disabled");
+    assert w_ctrl = x"42" report "Wrong ICTRL of disabled line" severity error;
+    write_ctrl(3, 16#02#);
+    assert w_ctrl = x"02" report "Pending bit not cleared" severity error;
+    
+    -- a request at the acknowledge of the same line is not lost
+    request(8);
+    r_SERVED <= event_of(8);
+    r_ACK <= '1';
+    r_INTERRUPT(8) <= '1';
+    clock_cycle;
+    r_ACK <= '0';
+    r_INTERRUPT(8) <= '0';
+    check_event(event_of(8), "request at acknowledge");
+    
+    -- ISEL that is no line
+    write_ctrl(g_int_lines + 1, 16#FF#);
+    assert UNSIGNED(w_ctrl) = 0 report "ICTRL of no line" severity error;
+    
+    r_RESET <= '1';
+    clock_cycle;
+    r_RESET <= '0';
+    check_event(c_no_event, "second reset");
+    write_ctrl(3, 0);
+    write_ctrl(3, 16#FF#);
+    r_DATA <= (others => '0');
+    r_WR_SEL <= '1';
+    clock_cycle;
+    r_WR_SEL <= '0';
+    wait for 1 ns;
+    assert UNSIGNED(w_ctrl) = 0 report "ISEL 0" severity error;
+    r_DATA <= STD_LOGIC_VECTOR(to_unsigned(3, g_bit));
+    r_WR_SEL <= '1';
+    clock_cycle;
+    r_WR_SEL <= '0';
+    wait for 1 ns;
+    assert w_ctrl = x"C7" report "ICTRL after write" severity error;
+    
+    report "Validation finished!";
+    stop_the_clock <= TRUE;
+    wait;
+  end process PROC_stim;
+
+
+  PROC_clk: process
+  begin
+    while not stop_the_clock loop
+      r_CLK <= '0'; 
+      wait for g_clock_period/2;
+      r_CLK <= '1';
+      wait for g_clock_period/2;
+    end loop;
+    wait;
+  end process PROC_clk;
+
+end architecture;
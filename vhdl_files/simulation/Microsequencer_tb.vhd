@@ -33,6 +33,9 @@
 -- MICROSEQUENCER TESTBENCH
 ----------------------------------------------------------------------------------
 -- Testing the microsequencer (via Waveform Viewer)
+-- First all jump conditions are tested (OP = '0', N/Z and C/V selected, C and V
+-- are the inverted values of N and Z), afterwards the dispatch,
+-- nested calls and the corresponding returns of micro-subroutines.
 ----------------------------------------------------------------------------------
 
 library IEEE;
@@ -48,47 +51,115 @@ end Microsquencer_tb;
 architecture testbench of Microsquencer_tb is
 
     component Microsequencer
+        Generic (
+          g_address_size : positive;
+          g_stack_depth : positive
+        );
         Port ( 
+          i_CLK : in STD_LOGIC;
           i_Z : in STD_LOGIC;
           i_N : in STD_LOGIC;
+          i_C : in STD_LOGIC;
+          i_V : in STD_LOGIC;
+          i_FLAG_SEL : in STD_LOGIC;
+          i_OP : in STD_LOGIC;
           i_COND : in STD_LOGIC_VECTOR (1 downto 0);
-          o_J : out STD_LOGIC 
+          i_RETURN_ADDRESS : in STD_LOGIC_VECTOR (g_address_size-1 downto 0);
+          o_RETURN_ADDRESS : out STD_LOGIC_VECTOR (g_address_size-1 downto 0);
+          o_MMUX_SEL : out STD_LOGIC_VECTOR (1 downto 0)
         );
     end component;
+    
+    constant c_address_size : positive := 12;
 
+    signal r_CLK: STD_LOGIC := '0';
     signal r_Z: STD_LOGIC := '0';
     signal r_N: STD_LOGIC := '0';
+    signal r_C: STD_LOGIC := '1';
+    signal r_V: STD_LOGIC := '1';
+    signal r_FLAG_SEL: STD_LOGIC := '0';
+    signal r_OP: STD_LOGIC := '0';
     signal r_COND: STD_LOGIC_VECTOR (1 downto 0) := "00";
-    signal w_j: STD_LOGIC;
+    signal r_RETURN_ADDRESS: STD_LOGIC_VECTOR (c_address_size-1 downto 0) 
+        := (others => '0');
+    signal w_return_address: STD_LOGIC_VECTOR (c_address_size-1 downto 0);
+    signal w_mmux_sel: STD_LOGIC_VECTOR (1 downto 0);
 
 begin
 
     uut: Microsequencer
+      generic map (
+        g_address_size => c_address_size,
+        g_stack_depth => 4
+      )
       port map ( 
+        i_CLK => r_CLK,
         i_Z => r_Z,
         i_N => r_N,
+        i_C => r_C,
+        i_V => r_V,
+        i_FLAG_SEL => r_FLAG_SEL,
+        i_OP => r_OP,
         i_COND => r_COND,
-        o_J => w_j 
+        i_RETURN_ADDRESS => r_RETURN_ADDRESS,
+        o_RETURN_ADDRESS => w_return_address,
+        o_MMUX_SEL => w_mmux_sel
       );
 
 
     PROC_stim: process
     begin
       -- iterate through the possible combinations
-      for i in 0 to 3 loop
-        r_COND <= STD_LOGIC_VECTOR(to_unsigned(i,2));
-      
-        for j in STD_LOGIC range '0' to '1' loop
-          r_Z <= j;
-          
-          for k in STD_LOGIC range '0' to '1' loop
-            r_N <= k;
-      
-          wait for 10 ns;
-          
+      for l in STD_LOGIC range '0' to '1' loop
+        r_FLAG_SEL <= l;
+        
+        for i in 0 to 3 loop
+          r_COND <= STD_LOGIC_VECTOR(to_unsigned(i,2));
+        
+          for j in STD_LOGIC range '0' to '1' loop
+            r_Z <= j;
+            r_V <= NOT j;
+            
+            for k in STD_LOGIC range '0' to '1' loop
+              r_N <= k;
+              r_C <= NOT k;
+        
+            wait for 10 ns;
+            
+            end loop;
           end loop;
         end loop;
       end loop;
+      r_FLAG_SEL <= '0';
+      
+      -- dispatch (no clock edge, stack unchanged)
+      r_OP <= '1';
+      r_COND <= "00";
+      wait for 10 ns;
+      r_COND <= "11";
+      wait for 10 ns;
+      
+      -- three nested calls (return addresses 0x101, 0x202, 0x303)
+      r_COND <= "01";
+      for i in 1 to 3 loop
+        r_RETURN_ADDRESS <= STD_LOGIC_VECTOR(to_unsigned(i*257,c_address_size));
+        wait for 5 ns;
+        r_CLK <= '1';
+        wait for 5 ns;
+        r_CLK <= '0';
+      end loop;
+      
+      -- three returns (top of stack: 0x303, 0x202, 0x101)
+      r_COND <= "10";
+      for i in 1 to 3 loop
+        wait for 5 ns;
+        r_CLK <= '1';
+        wait for 5 ns;
+        r_CLK <= '0';
+      end loop;
+      
+      r_OP <= '0';
+      r_COND <= "00";
     wait;
   end process PROC_stim;
 
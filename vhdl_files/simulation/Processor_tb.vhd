@@ -45,12 +45,65 @@
 --      the simulation stops (even only needed if previous bool is TRUE)
 -- If an interrupt routine should be performed the parameter file then provides
 -- a list of interrupts that should be performed:
---    - RSET, INT1 or INT2 indicating that the value of this certain interrupt
+--    - RSET or INTn (n: number of the interrupt line, 1 to c_interrupt_lines,
+--      e.g. INT1, INT12) indicating that the value of this certain interrupt
 --      should be set, followed by a bit (0/1) indicating which value.
 --    - WAIT followed by a time the interrupt process should be paused.
 -- The counter size of the debouncing circuit is set to 4 bit that the inputs
 -- on the interrupt lines only have to stay on the same level for about 2.2 us
 -- that they are recognized (including synchronization).
+-- If c_pipelined is TRUE the single clock module "Processor_Pipelined" is
+-- tested instead of "Processor" (same files, same results, 6 bit debouncing
+-- counter at the input clock of 100 MHz).
+-- c_queue_depth is the size of the prefetch queue of the processors 
+-- (g_queue_depth, 0: no queue). The reads of the queue (o_QUEUE_RD) are not 
+-- counted as appearances of the finish address, so the finish condition is 
+-- the same with and without the queue.
+-- Every finished RAM access (RD, WR) is written to the log file at the rising
+-- edge of o_CLK_MEMORY, a read of the queue is marked with "(queue)".
+-- Every rising edge of an INTn line starts an interrupt latency probe: the
+-- cycles of the processor (o_CLK_MAIN) until the first read of the handler
+-- (address of the JMP at the vector, or the vector itself if it contains no
+-- JMP; not a read of the queue) are written to the log file (including 
+-- synchronization/debouncing).
+-- At the end the number of logged RAM accesses (RD, WR) is written to the log
+-- file (e.g. "int_program_1" with an idle loop against "wai_program_1" with 
+-- WAI).
+-- c_bit selects the data width of the processor (8 or 16 bit, e.g. 
+-- "program_1_16bit"). The files then contain one word (2 or 4 hex digits) per
+-- line. The simulated RAM always has 2^16 words, for 16 bit only the lower 16
+-- bits of the 32 bit address are used (the memory is mirrored).
+-- c_interrupt_lines is the number of interrupt lines of the processor, the 
+-- vector table of the program needs 4 * (c_interrupt_lines + 2) bytes (see
+-- "vector_table_creator").
+-- If c_timer is TRUE a "Timer" is placed at 0xFE00 (clocked by o_CLK_MEMORY, 
+-- the RAM is not accessed at its registers) and requests the additional 
+-- interrupt line c_interrupt_lines + 1 (e.g. "timer_program_1", vector table
+-- then 4 * (c_interrupt_lines + 3) bytes).
+-- If c_dma is TRUE a "DMA" is placed at 0xFE08 and requests the line after 
+-- the timer (e.g. "dma_program_1"). It reads the RAM like a synchronous RAM 
+-- (at the rising edge of o_CLK_MEMORY) and writes at the rising edge, the 
+-- log file only contains the accesses of the processor.
+-- If c_dual_core is TRUE (only for "Processor") a second processor shares the
+-- RAM through a "Memory_Arbiter" (c_arbiter_policy). It has no interrupt line
+-- and starts at its own RESET vector behind the vector table (address 
+-- 4 * (c_interrupt_lines + 2), e.g. "dual_program_1": both processors 
+-- increment a counter in the RAM under a TAS lock). The log file contains the
+-- accesses of the RAM port (both processors).
+-- If c_perf_counters is TRUE a "Performance_Counter" is placed at 0xFE10 
+-- (e.g. "perf_program_1", "perf_wait_program_1" with c_wait_states 2) and 
+-- its counters are written to the log file at the end (hexadecimal: cycles, 
+-- instructions, RAM reads and writes of the RAM port and taken interrupts of
+-- processor 0).
+-- c_wait_states sets the latency of the RAM: every RAM access (RD or WR, not
+-- the registers of the timer, DMA and performance counter) is held for 
+-- c_wait_states cycles of the processor with a cleared READY (i_READY of the
+-- processor, or of the arbiter for c_dual_core) and is finished in the 
+-- following cycle. A read of the prefetch queue that is dropped by the 
+-- processor (cleared READY) is not finished, the count restarts with the next
+-- address. At the end the cycles of the processor (o_CLK_MAIN) and 
+-- the cycles with a cleared READY are written to the log file (e.g. 
+-- "bmov_program_1" with 0, 1 and 2 wait states, see README).
 ----------------------------------------------------------------------------------
 
 library IEEE;
@@ -59,6 +112,16 @@ use IEEE.STD_LOGIC_1164.ALL;
 -- Change parameter for simulation
 package processor_sim_parameters is
     constant c_pre_filename : STRING := "program_7";
+    constant c_pipelined : BOOLEAN := FALSE;
+    constant c_bit : POSITIVE := 8;
+    constant c_interrupt_lines : POSITIVE := 2;
+    constant c_timer : BOOLEAN := FALSE;
+    constant c_dma : BOOLEAN := FALSE;
+    constant c_dual_core : BOOLEAN := FALSE;
+    constant c_arbiter_policy : STRING := "ROUND_ROBIN";
+    constant c_perf_counters : BOOLEAN := FALSE;
+    constant c_wait_states : NATURAL := 0;
+    constant c_queue_depth : NATURAL := 4;
 end package processor_sim_parameters;
 
 
@@ -77,8 +140,8 @@ use work.functions.all;
 
 entity Processor_tb is
     Generic( 
-      g_bit : POSITIVE := 8;
-      g_interrupt_line_size : POSITIVE := 2
+      g_bit : POSITIVE := c_bit;
+      g_interrupt_line_size : POSITIVE := c_interrupt_lines
     );
 end Processor_tb;
 
@@ -89,7 +152,10 @@ architecture testbench of Processor_tb is
     component Processor
       Generic( 
         g_bit : POSITIVE := 8;
-        g_debounce_counter_bit_size : POSITIVE := 4
+        g_interrupt_line_size : POSITIVE := 2;
+        g_direct_interrupt_lines : NATURAL := 0;
+        g_debounce_counter_bit_size : POSITIVE := 4;
+        g_queue_depth : NATURAL := 4
       ); 
       Port ( 
         i_CLK : in STD_LOGIC;
@@ -98,11 +164,136 @@ architecture testbench of Processor_tb is
         o_ADDRESS : out STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
         o_RD : out STD_LOGIC;
         o_WR : out STD_LOGIC;
+        o_QUEUE_RD : out STD_LOGIC;
+        i_READY : in STD_LOGIC := '1';
+        o_LOCK : out STD_LOGIC;
+        o_RETIRE : out STD_LOGIC;
+        o_INT_TAKEN : out STD_LOGIC;
+        i_SNOOP_WR : in STD_LOGIC := '0';
+        i_SNOOP_ADDRESS : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0) 
+            := (others => '0');
         o_CLK_MEMORY : out STD_LOGIC;
         o_CLK_MAIN : out STD_LOGIC;
         io_DATA : inout STD_LOGIC_VECTOR (g_bit-1 downto 0) 
       );
     end component;
+
+    component Processor_Pipelined
+      Generic( 
+        g_bit : POSITIVE := 8;
+        g_interrupt_line_size : POSITIVE := 2;
+        g_direct_interrupt_lines : NATURAL := 0;
+        g_debounce_counter_bit_size : POSITIVE := 6;
+        g_queue_depth : NATURAL := 4
+      ); 
+      Port ( 
+        i_CLK : in STD_LOGIC;
+        i_RESET_PIN : in STD_LOGIC; 
+        i_INTERRUPT: in STD_LOGIC_VECTOR (1 to g_interrupt_line_size);
+        o_ADDRESS : out STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+        o_RD : out STD_LOGIC;
+        o_WR : out STD_LOGIC;
+        o_QUEUE_RD : out STD_LOGIC;
+        i_READY : in STD_LOGIC := '1';
+        o_RETIRE : out STD_LOGIC;
+        o_INT_TAKEN : out STD_LOGIC;
+        i_SNOOP_WR : in STD_LOGIC := '0';
+        i_SNOOP_ADDRESS : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0) 
+            := (others => '0');
+        o_CLK_MEMORY : out STD_LOGIC;
+        o_CLK_MAIN : out STD_LOGIC;
+        io_DATA : inout STD_LOGIC_VECTOR (g_bit-1 downto 0) 
+      );
+    end component;
+    
+    component Timer
+      Generic ( 
+        g_bit : POSITIVE := 8;
+        g_base_address : NATURAL := 16#FE00#
+      );
+      Port ( 
+        i_CLK : in STD_LOGIC;
+        i_ADDRESS : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+        i_DATA : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        i_WR : in STD_LOGIC;
+        o_DATA : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        o_SELECTED : out STD_LOGIC;
+        o_INTERRUPT : out STD_LOGIC
+      );
+    end component;
+    
+    component DMA
+      Generic ( 
+        g_bit : POSITIVE := 8;
+        g_base_address : NATURAL := 16#FE08#
+      );
+      Port ( 
+        i_CLK : in STD_LOGIC;
+        i_ADDRESS : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+        i_DATA : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        i_RD : in STD_LOGIC;
+        i_WR : in STD_LOGIC;
+        o_DATA : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        o_SELECTED : out STD_LOGIC;
+        i_RAM_DATA : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        o_RAM_ADDRESS : out STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+        o_RAM_DATA : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        o_RAM_ENABLE : out STD_LOGIC;
+        o_RAM_WRITE : out STD_LOGIC;
+        o_INTERRUPT : out STD_LOGIC
+      );
+    end component;
+    
+    component Performance_Counter
+      Generic ( 
+        g_bit : POSITIVE := 8;
+        g_base_address : NATURAL := 16#FE10#
+      );
+      Port ( 
+        i_CLK : in STD_LOGIC;
+        i_ADDRESS : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+        i_DATA : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        i_WR : in STD_LOGIC;
+        o_DATA : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        o_SELECTED : out STD_LOGIC;
+        i_RETIRE : in STD_LOGIC;
+        i_PROC_RD : in STD_LOGIC;
+        i_PROC_WR : in STD_LOGIC;
+        i_PROC_READY : in STD_LOGIC := '1';
+        i_INT_TAKEN : in STD_LOGIC;
+        o_CYCLES : out STD_LOGIC_VECTOR (4*g_bit-1 downto 0);
+        o_INSTRUCTIONS : out STD_LOGIC_VECTOR (4*g_bit-1 downto 0);
+        o_READS : out STD_LOGIC_VECTOR (4*g_bit-1 downto 0);
+        o_WRITES : out STD_LOGIC_VECTOR (4*g_bit-1 downto 0);
+        o_INTERRUPTS : out STD_LOGIC_VECTOR (4*g_bit-1 downto 0)
+      );
+    end component;
+    
+    component Memory_Arbiter
+      Generic ( 
+        g_bit : POSITIVE := 8;
+        g_policy : STRING := "ROUND_ROBIN";
+        g_reset_vector_1 : NATURAL := 16#0018#
+      );
+      Port ( 
+        i_CLK : in STD_LOGIC;
+        i_ADDRESS_0 : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+        i_RD_0 : in STD_LOGIC;
+        i_WR_0 : in STD_LOGIC;
+        i_LOCK_0 : in STD_LOGIC;
+        o_READY_0 : out STD_LOGIC;
+        i_ADDRESS_1 : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+        i_RD_1 : in STD_LOGIC;
+        i_WR_1 : in STD_LOGIC;
+        i_LOCK_1 : in STD_LOGIC;
+        o_READY_1 : out STD_LOGIC;
+        o_ADDRESS : out STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+        o_RD : out STD_LOGIC;
+        o_WR : out STD_LOGIC;
+        o_GRANT : out STD_LOGIC;
+        i_READY : in STD_LOGIC := '1'
+      );
+    end component;
     
     -- filenames (using constant pre_filename and extending it)
     constant c_filename_mem_in : STRING := c_pre_filename & "_MEM_IN.txt"; 
@@ -117,21 +308,77 @@ architecture testbench of Processor_tb is
     file file_log : TEXT; -- log read and write operations
     file file_mem_log : TEXT; -- log memory content
            
-    signal r_RAM : t_RAM (0 to 2**(2*g_bit)-1) := 
+    -- number of address bits connected to the simulated RAM
+    constant c_ram_bit_size : POSITIVE := 16;
+           
+    signal r_RAM : t_RAM (0 to 2**c_ram_bit_size-1) := 
         initRam("..\..\..\Testbench_Files\Programs\" & 
-        c_filename_mem_in, 2**(2*g_bit)-1);
+        c_filename_mem_in, 2**c_ram_bit_size-1, g_bit);
  
     signal r_CLK : STD_LOGIC := '0';
 
-    signal w_address : STD_LOGIC_VECTOR (15 downto 0);
+    signal w_address : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+    alias w_ram_address : STD_LOGIC_VECTOR (c_ram_bit_size-1 downto 0) is 
+        w_address(c_ram_bit_size-1 downto 0);
     signal w_rd : STD_LOGIC;
     signal w_wr : STD_LOGIC;
-    signal rw_DATA_MEM : STD_LOGIC_VECTOR (7 downto 0) := (others => 'Z');
+    signal w_queue_rd : STD_LOGIC; -- w_rd is a read of the prefetch queue
+    signal w_clk_main : STD_LOGIC;
+    signal w_clk_memory : STD_LOGIC;
+    signal rw_DATA_MEM : STD_LOGIC_VECTOR (g_bit-1 downto 0) := (others => 'Z');
+    
+    -- wait states: READY is sampled at o_CLK_MAIN (pipelined) or o_CLK_MEMORY
+    signal w_clk_ready : STD_LOGIC;
+    signal w_ready : STD_LOGIC;
+    signal r_WAIT_COUNT : NATURAL := 0;
+    signal r_WAIT_ADDRESS : STD_LOGIC_VECTOR (2*g_bit-1 downto 0) 
+        := (others => '0');
+    signal w_wait_count : NATURAL;
+    signal r_HELD_CYCLES : NATURAL := 0;
+    signal r_CYCLES : NATURAL := 0;
     
     signal r_RESET : STD_LOGIC := '0';
-    signal r_INTERRUPT : STD_LOGIC_VECTOR (1 to 2) := "00";
-    alias r_INT1 : STD_LOGIC is r_INTERRUPT(1);
-    alias r_INT2 : STD_LOGIC is r_INTERRUPT(2);
+    signal r_INTERRUPT : STD_LOGIC_VECTOR (1 to g_interrupt_line_size) 
+        := (others => '0');
+    
+    -- interrupt lines of the processor (timer and DMA as last lines)
+    constant c_direct_lines : NATURAL := BOOLEAN'POS(c_timer) + 
+        BOOLEAN'POS(c_dma);
+    constant c_uut_lines : POSITIVE := g_interrupt_line_size + c_direct_lines;
+    
+    -- RESET vector of the second processor (behind the vector table)
+    constant c_reset_vector_1 : NATURAL := 4 * (c_uut_lines + 2);
+    signal w_uut_interrupt : STD_LOGIC_VECTOR (1 to c_uut_lines);
+    
+    signal w_timer_data : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_timer_selected : STD_LOGIC := '0';
+    signal w_timer_interrupt : STD_LOGIC := '0';
+    
+    signal w_dma_data : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_dma_selected : STD_LOGIC := '0';
+    signal w_dma_interrupt : STD_LOGIC := '0';
+    signal w_dma_ram_address : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+    alias w_dma_ram_index : STD_LOGIC_VECTOR (c_ram_bit_size-1 downto 0) is 
+        w_dma_ram_address(c_ram_bit_size-1 downto 0);
+    signal w_dma_ram_data : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_dma_ram_write : STD_LOGIC := '0';
+    -- word read by the DMA (synchronous RAM)
+    signal r_DMA_RAM_DATA : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    
+    -- writes of the RAM port and the DMA (clear the prefetch queues)
+    signal w_snoop_wr : STD_LOGIC;
+    signal w_snoop_address : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+    
+    -- profiling outputs of processor 0 and the performance counter
+    signal w_retire : STD_LOGIC;
+    signal w_int_taken : STD_LOGIC;
+    signal w_perf_data : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_perf_selected : STD_LOGIC := '0';
+    signal w_perf_cycles : STD_LOGIC_VECTOR (4*g_bit-1 downto 0);
+    signal w_perf_instructions : STD_LOGIC_VECTOR (4*g_bit-1 downto 0);
+    signal w_perf_reads : STD_LOGIC_VECTOR (4*g_bit-1 downto 0);
+    signal w_perf_writes : STD_LOGIC_VECTOR (4*g_bit-1 downto 0);
+    signal w_perf_interrupts : STD_LOGIC_VECTOR (4*g_bit-1 downto 0);
     
     -- indicate which finish condition is active
     signal finished_address_condition : BOOLEAN;
@@ -147,18 +394,256 @@ architecture testbench of Processor_tb is
 
 begin
 
-    uut: Processor
-      port map ( 
-        i_CLK => r_CLK,
-        i_RESET_PIN => r_RESET,
-        i_INTERRUPT => r_INTERRUPT,
-        o_ADDRESS => w_address,
-        o_RD => w_rd,
-        o_WR => w_wr,
-        io_DATA => rw_DATA_MEM,
-        o_CLK_MEMORY => open, -- simulating asynchronous RAM (not clocked)
-        o_CLK_MAIN => open    -- not needed in this simulation
-      );
+    -- synthesis translate_off
+    assert NOT(c_dual_core AND c_pipelined)
+    report("Parameter error: c_dual_core only for the multiphase processor!")
+    severity failure;
+    -- synthesis translate_on
+
+    UUT_MULTI_PHASE: if NOT(c_pipelined) AND NOT(c_dual_core) generate
+      uut: Processor
+        generic map (
+          g_bit => g_bit,
+          g_interrupt_line_size => c_uut_lines,
+          g_direct_interrupt_lines => c_direct_lines,
+          g_queue_depth => c_queue_depth
+        )
+        port map ( 
+          i_CLK => r_CLK,
+          i_RESET_PIN => r_RESET,
+          i_INTERRUPT => w_uut_interrupt,
+          o_ADDRESS => w_address,
+          o_RD => w_rd,
+          o_WR => w_wr,
+          o_QUEUE_RD => w_queue_rd,
+          i_READY => w_ready,
+          o_RETIRE => w_retire,
+          o_INT_TAKEN => w_int_taken,
+          i_SNOOP_WR => w_snoop_wr,
+          i_SNOOP_ADDRESS => w_snoop_address,
+          io_DATA => rw_DATA_MEM,
+          -- RAM is asynchronous (not clocked), only used for the timer
+          o_CLK_MEMORY => w_clk_memory,
+          o_CLK_MAIN => w_clk_main -- counts cycles of the latency probe
+        );
+    end generate UUT_MULTI_PHASE;
+    
+    UUT_PIPELINED: if c_pipelined generate
+      uut: Processor_Pipelined
+        generic map (
+          g_bit => g_bit,
+          g_interrupt_line_size => c_uut_lines,
+          g_direct_interrupt_lines => c_direct_lines,
+          g_queue_depth => c_queue_depth
+        )
+        port map ( 
+          i_CLK => r_CLK,
+          i_RESET_PIN => r_RESET,
+          i_INTERRUPT => w_uut_interrupt,
+          o_ADDRESS => w_address,
+          o_RD => w_rd,
+          o_WR => w_wr,
+          o_QUEUE_RD => w_queue_rd,
+          i_READY => w_ready,
+          o_RETIRE => w_retire,
+          o_INT_TAKEN => w_int_taken,
+          i_SNOOP_WR => w_snoop_wr,
+          i_SNOOP_ADDRESS => w_snoop_address,
+          io_DATA => rw_DATA_MEM,
+          -- RAM is asynchronous (not clocked), only used for the timer
+          o_CLK_MEMORY => w_clk_memory,
+          o_CLK_MAIN => w_clk_main -- counts cycles of the latency probe
+        );
+    end generate UUT_PIPELINED;
+    
+    -- two processors, the arbiter drives the RAM port (w_address, w_rd, w_wr,
+    -- rw_DATA_MEM)
+    UUT_DUAL_CORE: if c_dual_core generate
+      signal w_address_0 : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+      signal w_address_1 : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+      signal w_rd_0 : STD_LOGIC;
+      signal w_rd_1 : STD_LOGIC;
+      signal w_queue_rd_0 : STD_LOGIC;
+      signal w_queue_rd_1 : STD_LOGIC;
+      signal w_queue_rd_1_delayed : STD_LOGIC;
+      signal w_wr_0 : STD_LOGIC;
+      signal w_wr_1 : STD_LOGIC;
+      signal w_lock_0 : STD_LOGIC;
+      signal w_lock_1 : STD_LOGIC;
+      signal w_ready_0 : STD_LOGIC;
+      signal w_ready_1 : STD_LOGIC;
+      signal w_grant : STD_LOGIC;
+      signal w_no_interrupt : STD_LOGIC_VECTOR (1 to 1) := "0";
+      signal rw_DATA_0 : STD_LOGIC_VECTOR (g_bit-1 downto 0) 
+          := (others => 'Z');
+      signal rw_DATA_1 : STD_LOGIC_VECTOR (g_bit-1 downto 0) 
+          := (others => 'Z');
+    begin
+      uut: Processor
+        generic map (
+          g_bit => g_bit,
+          g_interrupt_line_size => c_uut_lines,
+          g_direct_interrupt_lines => c_direct_lines,
+          g_queue_depth => c_queue_depth
+        )
+        port map ( 
+          i_CLK => r_CLK,
+          i_RESET_PIN => r_RESET,
+          i_INTERRUPT => w_uut_interrupt,
+          o_ADDRESS => w_address_0,
+          o_RD => w_rd_0,
+          o_WR => w_wr_0,
+          o_QUEUE_RD => w_queue_rd_0,
+          i_READY => w_ready_0,
+          o_LOCK => w_lock_0,
+          o_RETIRE => w_retire,
+          o_INT_TAKEN => w_int_taken,
+          i_SNOOP_WR => w_snoop_wr,
+          i_SNOOP_ADDRESS => w_snoop_address,
+          io_DATA => rw_DATA_0,
+          o_CLK_MEMORY => w_clk_memory,
+          o_CLK_MAIN => w_clk_main
+        );
+        
+      uut_1: Processor
+        generic map (
+          g_bit => g_bit,
+          g_interrupt_line_size => 1,
+          g_queue_depth => c_queue_depth
+        )
+        port map ( 
+          i_CLK => r_CLK,
+          i_RESET_PIN => r_RESET,
+          i_INTERRUPT => w_no_interrupt,
+          o_ADDRESS => w_address_1,
+          o_RD => w_rd_1,
+          o_WR => w_wr_1,
+          o_QUEUE_RD => w_queue_rd_1,
+          i_READY => w_ready_1,
+          o_LOCK => w_lock_1,
+          o_RETIRE => open,
+          o_INT_TAKEN => open,
+          i_SNOOP_WR => w_snoop_wr,
+          i_SNOOP_ADDRESS => w_snoop_address,
+          io_DATA => rw_DATA_1,
+          o_CLK_MEMORY => open,
+          o_CLK_MAIN => open
+        );
+        
+      Memory_Arbiter_inst: Memory_Arbiter
+        generic map (
+          g_bit => g_bit,
+          g_policy => c_arbiter_policy,
+          g_reset_vector_1 => c_reset_vector_1
+        )
+        port map ( 
+          i_CLK => w_clk_memory,
+          i_ADDRESS_0 => w_address_0,
+          i_RD_0 => w_rd_0,
+          i_WR_0 => w_wr_0,
+          i_LOCK_0 => w_lock_0,
+          o_READY_0 => w_ready_0,
+          i_ADDRESS_1 => w_address_1,
+          i_RD_1 => w_rd_1,
+          i_WR_1 => w_wr_1,
+          i_LOCK_1 => w_lock_1,
+          o_READY_1 => w_ready_1,
+          o_ADDRESS => w_address,
+          o_RD => w_rd,
+          o_WR => w_wr,
+          o_GRANT => w_grant,
+          i_READY => w_ready
+        );
+      
+      -- write data of the processor that got the RAM, the read data goes to
+      -- every reading processor (the one that did not get the RAM repeats)
+      rw_DATA_MEM <= rw_DATA_1 when (w_wr = '1' AND w_grant = '1') else
+                     rw_DATA_0 when w_wr = '1' else
+                     (others => 'Z');
+      rw_DATA_0 <= rw_DATA_MEM when w_rd_0 = '1' else (others => 'Z');
+      rw_DATA_1 <= rw_DATA_MEM when w_rd_1 = '1' else (others => 'Z');
+      
+      -- queue read of the processor that got the RAM (processor 1 one delta 
+      -- cycle later, like its relocated address in the arbiter)
+      w_queue_rd_1_delayed <= w_queue_rd_1;
+      w_queue_rd <= w_queue_rd_1_delayed when w_grant = '1' else w_queue_rd_0;
+    end generate UUT_DUAL_CORE;
+    
+    
+    TIMER_ON: if c_timer generate
+      Timer_inst: Timer
+        generic map (
+          g_bit => g_bit
+        )
+        port map ( 
+          i_CLK => w_clk_memory,
+          i_ADDRESS => w_address,
+          i_DATA => rw_DATA_MEM,
+          i_WR => w_wr,
+          o_DATA => w_timer_data,
+          o_SELECTED => w_timer_selected,
+          o_INTERRUPT => w_timer_interrupt
+        );
+      w_uut_interrupt(g_interrupt_line_size + 1) <= w_timer_interrupt;
+    end generate TIMER_ON;
+    
+    DMA_ON: if c_dma generate
+      DMA_inst: DMA
+        generic map (
+          g_bit => g_bit
+        )
+        port map ( 
+          i_CLK => w_clk_memory,
+          i_ADDRESS => w_address,
+          i_DATA => rw_DATA_MEM,
+          i_RD => w_rd,
+          i_WR => w_wr,
+          o_DATA => w_dma_data,
+          o_SELECTED => w_dma_selected,
+          i_RAM_DATA => r_DMA_RAM_DATA,
+          o_RAM_ADDRESS => w_dma_ram_address,
+          o_RAM_DATA => w_dma_ram_data,
+          o_RAM_ENABLE => open, -- own read port of the simulated RAM
+          o_RAM_WRITE => w_dma_ram_write,
+          o_INTERRUPT => w_dma_interrupt
+        );
+      w_uut_interrupt(c_uut_lines) <= w_dma_interrupt;
+      
+      PROC_dma_read: process (w_clk_memory)
+      begin
+        if rising_edge(w_clk_memory) then
+          r_DMA_RAM_DATA <= 
+              r_RAM(to_integer(UNSIGNED(w_dma_ram_index)))(g_bit-1 downto 0);
+        end if;
+      end process PROC_dma_read;
+    end generate DMA_ON;
+    
+    PERF_ON: if c_perf_counters generate
+      Performance_Counter_inst: Performance_Counter
+        generic map (
+          g_bit => g_bit
+        )
+        port map ( 
+          i_CLK => w_clk_memory,
+          i_ADDRESS => w_address,
+          i_DATA => rw_DATA_MEM,
+          i_WR => w_wr,
+          o_DATA => w_perf_data,
+          o_SELECTED => w_perf_selected,
+          i_RETIRE => w_retire,
+          i_PROC_RD => w_rd,
+          i_PROC_WR => w_wr,
+          i_PROC_READY => w_ready,
+          i_INT_TAKEN => w_int_taken,
+          o_CYCLES => w_perf_cycles,
+          o_INSTRUCTIONS => w_perf_instructions,
+          o_READS => w_perf_reads,
+          o_WRITES => w_perf_writes,
+          o_INTERRUPTS => w_perf_interrupts
+        );
+    end generate PERF_ON;
+    
+    w_uut_interrupt(1 to g_interrupt_line_size) <= r_INTERRUPT;
                          
 
     PROC_stim: process
@@ -166,7 +651,7 @@ begin
       variable v_line_pointer_write : LINE;
       variable v_fstatus : FILE_OPEN_STATUS;     
       
-      variable v_memory_block : STD_LOGIC_VECTOR (7 downto 0);
+      variable v_memory_block : STD_LOGIC_VECTOR (g_bit-1 downto 0);
       
       variable v_check_memory : BOOLEAN;
       variable v_finish_address : BOOLEAN;
@@ -174,6 +659,10 @@ begin
       variable v_end_address_count : POSITIVE := 1;
       
       variable v_end_memory_correct : BOOLEAN := TRUE;
+      
+      -- number of logged RAM accesses
+      variable v_reads : NATURAL := 0;
+      variable v_writes : NATURAL := 0;
  
     begin
     
@@ -246,7 +735,7 @@ begin
       
       -- log read and write operations
       while TRUE loop
-        wait until falling_edge(w_rd) OR falling_edge(w_wr) OR 
+        wait until rising_edge(w_clk_memory) OR 
             (finished_interrupts = TRUE) OR (finished_address = TRUE);
         
         if (finished_interrupts = TRUE) OR (finished_address = TRUE) then
@@ -262,21 +751,61 @@ begin
           end if;
           writeline(file_log, v_line_pointer_write);
           
+          write(v_line_pointer_write, STRING'("RAM accesses: "));
+          write(v_line_pointer_write, v_reads);
+          write(v_line_pointer_write, STRING'(" RD, "));
+          write(v_line_pointer_write, v_writes);
+          write(v_line_pointer_write, STRING'(" WR"));
+          writeline(file_log, v_line_pointer_write);
+          
+          write(v_line_pointer_write, STRING'("Cycles: "));
+          write(v_line_pointer_write, r_CYCLES);
+          write(v_line_pointer_write, STRING'(", wait states: "));
+          write(v_line_pointer_write, c_wait_states);
+          write(v_line_pointer_write, STRING'(", held cycles: "));
+          write(v_line_pointer_write, r_HELD_CYCLES);
+          writeline(file_log, v_line_pointer_write);
+          
+          if c_perf_counters then
+            write(v_line_pointer_write, STRING'("Performance counters: "));
+            hwrite(v_line_pointer_write, w_perf_cycles);
+            write(v_line_pointer_write, STRING'(" cycles, "));
+            hwrite(v_line_pointer_write, w_perf_instructions);
+            write(v_line_pointer_write, STRING'(" instructions, "));
+            hwrite(v_line_pointer_write, w_perf_reads);
+            write(v_line_pointer_write, STRING'(" RD, "));
+            hwrite(v_line_pointer_write, w_perf_writes);
+            write(v_line_pointer_write, STRING'(" WR, "));
+            hwrite(v_line_pointer_write, w_perf_interrupts);
+            write(v_line_pointer_write, STRING'(" interrupts"));
+            writeline(file_log, v_line_pointer_write);
+          end if;
+          
           exit; -- exit while loop
-        elsif falling_edge(w_rd) then
+        -- finished accesses (o_RD stays set for consecutive reads of the queue)
+        elsif w_rd = '1' AND w_ready = '1' then
+          v_reads := v_reads + 1;
           write(v_line_pointer_write, STRING'("RD "));
-          hwrite(v_line_pointer_write, r_RAM(to_integer(UNSIGNED(w_address))));
+          hwrite(v_line_pointer_write,
+              r_RAM(to_integer(UNSIGNED(w_ram_address)))(g_bit-1 downto 0));
           write(v_line_pointer_write, STRING'(" from "));
-          write(v_line_pointer_write, to_integer(UNSIGNED(w_address)), right, 5);
+          write(v_line_pointer_write, to_integer(UNSIGNED(w_ram_address)),
+              right, 5);
           write(v_line_pointer_write, STRING'(" at "));
           write(v_line_pointer_write, integer'image((now/TIME'val(1))/10**6));
           write(v_line_pointer_write, STRING'(" us"));
+          if w_queue_rd = '1' then
+            write(v_line_pointer_write, STRING'(" (queue)"));
+          end if;
           writeline(file_log, v_line_pointer_write); 
-        elsif falling_edge(w_wr) then
+        elsif w_wr = '1' AND w_ready = '1' then
+          v_writes := v_writes + 1;
           write(v_line_pointer_write, STRING'("WR "));
-          hwrite(v_line_pointer_write, r_RAM(to_integer(UNSIGNED(w_address))));
+          hwrite(v_line_pointer_write,
+              r_RAM(to_integer(UNSIGNED(w_ram_address)))(g_bit-1 downto 0));
           write(v_line_pointer_write, STRING'("  to  "));
-          write(v_line_pointer_write, to_integer(UNSIGNED(w_address)), right, 5);
+          write(v_line_pointer_write, to_integer(UNSIGNED(w_ram_address)),
+              right, 5);
           write(v_line_pointer_write, STRING'(" at "));
           write(v_line_pointer_write, integer'image((now/TIME'val(1))/10**6));
           write(v_line_pointer_write, STRING'(" us"));
@@ -287,23 +816,24 @@ begin
       -- checks if all writes were correct 
       -- (only at end, no check if more write at same location were correct)
       if v_check_memory = TRUE then
-        for j in 0 to 65535 loop
+        for j in 0 to 2**c_ram_bit_size-1 loop
           readline(file_mem_out, v_line_pointer_read);
           hread(v_line_pointer_read, v_memory_block);
         
-          assert(v_memory_block = r_RAM(j))
+          assert(v_memory_block = r_RAM(j)(g_bit-1 downto 0))
           report("Wrong content at RAM location " & integer'image(j))
           severity error;
           
           -- memory value
-          hwrite(v_line_pointer_write, r_RAM(j));
-          write(v_line_pointer_write, to_integer(UNSIGNED(r_RAM(j))), right, 4);
+          hwrite(v_line_pointer_write, r_RAM(j)(g_bit-1 downto 0));
+          write(v_line_pointer_write,
+              to_integer(UNSIGNED(r_RAM(j)(g_bit-1 downto 0))), right, 4);
           
           -- reference
           hwrite(v_line_pointer_write, v_memory_block, right, 5);
           write(v_line_pointer_write, to_integer(UNSIGNED(v_memory_block)), right, 7);
           
-          if v_memory_block = r_RAM(j) then
+          if v_memory_block = r_RAM(j)(g_bit-1 downto 0) then
             write(v_line_pointer_write, STRING'("   OK"));
           else
             write(v_line_pointer_write, STRING'("   ERROR"));
@@ -320,9 +850,10 @@ begin
         end if;
       else
 
-        for j in 0 to 65535 loop 
-          hwrite(v_line_pointer_write, r_RAM(j));
-          write(v_line_pointer_write, to_integer(UNSIGNED(r_RAM(j))), right, 4);
+        for j in 0 to 2**c_ram_bit_size-1 loop 
+          hwrite(v_line_pointer_write, r_RAM(j)(g_bit-1 downto 0));
+          write(v_line_pointer_write,
+              to_integer(UNSIGNED(r_RAM(j)(g_bit-1 downto 0))), right, 4);
 
           writeline(file_mem_log, v_line_pointer_write);        
         end loop;      
@@ -340,11 +871,19 @@ begin
     end process PROC_stim;
     
     
-    PROC_stop_execution_address: process (w_address)
+    -- the addresses of the queue reads are skipped (o_ADDRESS and o_QUEUE_RD 
+    -- change in the same delta cycle), so an address that appears again after
+    -- them is not counted twice
+    PROC_stop_execution_address: process (w_address, w_queue_rd)
       variable v_appearance_count : NATURAL := 0;
+      variable v_last_address : INTEGER := -1;
     begin
-      if to_integer(UNSIGNED(w_address)) = w_end_address then
-        v_appearance_count := v_appearance_count + 1; 
+      if w_queue_rd = '0' AND 
+         to_integer(UNSIGNED(w_ram_address)) /= v_last_address then
+        v_last_address := to_integer(UNSIGNED(w_ram_address));
+        if v_last_address = w_end_address then
+          v_appearance_count := v_appearance_count + 1; 
+        end if;
       end if;   
       if finished_address_condition = TRUE then
         if v_appearance_count = w_end_address_count then
@@ -358,8 +897,10 @@ begin
     
       variable v_line_pointer_read : LINE;
       variable v_fstatus : FILE_OPEN_STATUS;  
-      -- to make it simple all input strings must have length 4
+      -- to make it simple all input strings must have length 4 (INTn: "INT"
+      -- followed by the line number)
       variable v_input_string : STRING (1 to 4);
+      variable v_input_line : POSITIVE;
       variable v_input_value : STD_LOGIC;  
       variable v_input_time : TIME; 
       
@@ -378,17 +919,24 @@ begin
         while not endfile(file_parameters) loop
           
           readline(file_parameters, v_line_pointer_read);
-          read(v_line_pointer_read, v_input_string);
+          read(v_line_pointer_read, v_input_string(1 to 3));
+          if v_input_string(1 to 3) = "INT" then
+            read(v_line_pointer_read, v_input_line);
+            v_input_string(4) := 'n';
+          else
+            read(v_line_pointer_read, v_input_string(4));
+          end if;
           
           if v_input_string = "RSET" then
             read(v_line_pointer_read, v_input_value);
             r_RESET <= v_input_value;
-          elsif v_input_string = "INT1" then
-            read(v_line_pointer_read, v_input_value);
-            r_INT1 <= v_input_value;
-          elsif v_input_string = "INT2" then
+          elsif v_input_string = "INTn" then
+            assert(v_input_line <= g_interrupt_line_size)
+            report("Interrupt line INT" & integer'image(v_input_line) & 
+                " does not exist!")
+            severity failure;
             read(v_line_pointer_read, v_input_value);
-            r_INT2 <= v_input_value;
+            r_INTERRUPT(v_input_line) <= v_input_value;
           elsif v_input_string = "WAIT" then
             read(v_line_pointer_read, v_input_time);
             wait for v_input_time;
@@ -404,17 +952,121 @@ begin
     end process PROC_execute_int;
     
     
+    -- interrupt latency probe (one per interrupt line)
+    GEN_latency: for i in 1 to g_interrupt_line_size generate
+      PROC_interrupt_latency: process
+        -- vector of INTi (EVENT register i + 1, 4 bytes per vector)
+        constant c_vector : NATURAL := 4*(i+1);
+        variable v_line_pointer_write : LINE;
+        variable v_handler_address : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+        variable v_handler : NATURAL;
+        variable v_cycles : NATURAL;
+        variable v_start_time : TIME;
+      begin
+        wait until rising_edge(r_INTERRUPT(i));
+        v_start_time := now;
+        v_cycles := 0;
+        
+        -- 7E: JMP ext, the handler is the operand of the JMP
+        if UNSIGNED(r_RAM(c_vector)(g_bit-1 downto 0)) = 16#7E# then
+          v_handler_address := r_RAM(c_vector+1)(g_bit-1 downto 0) & 
+              r_RAM(c_vector+2)(g_bit-1 downto 0);
+          v_handler := to_integer(UNSIGNED(
+              v_handler_address(c_ram_bit_size-1 downto 0)));
+        else
+          v_handler := c_vector;
+        end if;
+        
+        loop
+          wait on w_clk_main, w_rd, w_address;
+          if rising_edge(w_clk_main) then
+            v_cycles := v_cycles + 1;
+          end if;
+          exit when (w_rd = '1') AND (w_queue_rd = '0') AND 
+              (to_integer(UNSIGNED(w_ram_address)) = v_handler);
+        end loop;
+        
+        write(v_line_pointer_write, STRING'("INT"));
+        write(v_line_pointer_write, i);
+        write(v_line_pointer_write, STRING'(" latency: "));
+        write(v_line_pointer_write, v_cycles);
+        write(v_line_pointer_write, STRING'(" cycles ("));
+        write(v_line_pointer_write, (now - v_start_time) / 1 ns);
+        write(v_line_pointer_write, STRING'(" ns) until handler at "));
+        write(v_line_pointer_write, v_handler);
+        writeline(file_log, v_line_pointer_write);
+      end process PROC_interrupt_latency;
+    end generate GEN_latency;
+    
+    
+    -- the DMA only writes in cycles without access of the processors
+    w_snoop_wr <= w_wr OR w_dma_ram_write;
+    w_snoop_address <= w_dma_ram_address when w_dma_ram_write = '1' else
+                       w_address;
+    
+    
+    -- wait states of the RAM: READY is cleared for the first c_wait_states
+    -- cycles of an access (the count restarts for another address, as a 
+    -- dropped read of the prefetch queue is not repeated)
+    w_clk_ready <= w_clk_main when c_pipelined else w_clk_memory;
+    w_wait_count <= r_WAIT_COUNT when w_address = r_WAIT_ADDRESS else 0;
+    w_ready <= '0' when (w_rd = '1' OR w_wr = '1') AND 
+                        w_timer_selected = '0' AND w_dma_selected = '0' AND
+                        w_perf_selected = '0' AND
+                        w_wait_count < c_wait_states else '1';
+    
+    PROC_wait_states: process (w_clk_ready)
+    begin
+      if rising_edge(w_clk_ready) then
+        if w_ready = '0' then
+          r_WAIT_COUNT <= w_wait_count + 1;
+          r_WAIT_ADDRESS <= w_address;
+          r_HELD_CYCLES <= r_HELD_CYCLES + 1;
+        else
+          r_WAIT_COUNT <= 0;
+        end if;
+      end if;
+    end process PROC_wait_states;
+    
+    PROC_cycles: process (w_clk_main)
+    begin
+      if rising_edge(w_clk_main) then
+        r_CYCLES <= r_CYCLES + 1;
+      end if;
+    end process PROC_cycles;
+    
+    
     -- imitates an external asynchronous RAM (not clocked)
-    PROC_memory: process (w_rd, w_wr, r_RAM, rw_DATA_MEM, w_address)
+    -- (the DMA writes at the rising edge of the memory clock)
+    PROC_memory: process (w_rd, w_wr, r_RAM, rw_DATA_MEM, w_address, 
+        w_timer_selected, w_timer_data, w_dma_selected, w_dma_data, 
+        w_perf_selected, w_perf_data, w_clk_memory)
     begin   
-        if w_rd = '1' then -- RD
-          rw_DATA_MEM <=  r_RAM(to_integer(unsigned((w_address))));
+        if w_timer_selected = '1' OR w_dma_selected = '1' OR 
+           w_perf_selected = '1' then -- registers
+          if w_rd = '1' AND w_timer_selected = '1' then
+            rw_DATA_MEM <= w_timer_data;
+          elsif w_rd = '1' AND w_dma_selected = '1' then
+            rw_DATA_MEM <= w_dma_data;
+          elsif w_rd = '1' then
+            rw_DATA_MEM <= w_perf_data;
+          else
+            rw_DATA_MEM <= (others => 'Z');
+          end if;
+        elsif w_rd = '1' then -- RD
+          rw_DATA_MEM <= 
+              r_RAM(to_integer(unsigned(w_ram_address)))(g_bit-1 downto 0);
         elsif w_wr = '1' then -- WR
-          r_RAM(to_integer(unsigned((w_address)))) <= rw_DATA_MEM;
+          r_RAM(to_integer(unsigned(w_ram_address)))(g_bit-1 downto 0) <= 
+              rw_DATA_MEM;
           rw_DATA_MEM <= (others => 'Z');
         else
           rw_DATA_MEM <= (others => 'Z');
         end if;
+        if rising_edge(w_clk_memory) AND w_dma_ram_write = '1' then
+          r_RAM(to_integer(unsigned(w_dma_ram_index)))(g_bit-1 downto 0) <= 
+              w_dma_ram_data;
+        end if;
     end process PROC_memory;
     
     
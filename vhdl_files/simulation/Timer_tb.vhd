@@ -0,0 +1,183 @@
+-- BSD 3-Clause License
+-- 
+-- Copyright (c) 2018, Bernhard Vacarescu
+-- All rights reserved.
+-- 
+-- Redistribution and use in source and binary forms, with or without
+-- modification, are permitted provided that the following conditions are met:
+-- 
+-- * Redistributions of source code must retain the above copyright notice, this
+--   list of conditions and the following disclaimer.
+-- 
+-- * Redistributions in binary form must reproduce the above copyright notice,
+--   this list of conditions and the following disclaimer in the documentation
+--   and/or other materials provided with the distribution.
+-- 
+-- * Neither the name of the copyright holder nor the names of its
+--   contributors may be used to endorse or promote products derived from
+--   this software without specific prior written permission.
+-- 
+-- THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+-- AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+-- IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+-- DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+-- FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+-- DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+-- SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+-- CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+-- OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+-- OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+----------------------------------------------------------------------------------
+-- TIMER TESTBENCH
+----------------------------------------------------------------------------------
+-- Writes the registers of the timer like the processor (address, data and WR
+-- valid at the rising edge) and checks:
+--    - auto-reload: the interrupt comes every (COMP + 1) * (PRESCALE + 1) 
+--      clock cycles and the match flag is set
+--    - a write of CTRL clears the match flag
+--    - one-shot: after the match the timer stops (run cleared, counter stays
+--      at the compare value)
+--    - the RAM addresses next to the registers are not selected
+----------------------------------------------------------------------------------
+
+library IEEE;
+use IEEE.STD_LOGIC_1164.ALL;
+use IEEE.NUMERIC_STD.ALL;
+
+
+entity Timer_tb is
+    Generic (
+      g_clock_period : TIME := 10 ns
+    );  
+end Timer_tb;
+
+architecture testbench of Timer_tb is
+
+    component Timer
+      Generic ( 
+        g_bit : POSITIVE := 8;
+        g_base_address : NATURAL := 16#FE00#
+      );
+      Port ( 
+        i_CLK : in STD_LOGIC;
+        i_ADDRESS : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+        i_DATA : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        i_WR : in STD_LOGIC;
+        o_DATA : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        o_SELECTED : out STD_LOGIC;
+        o_INTERRUPT : out STD_LOGIC
+      );
+    end component;
+
+    signal r_CLK : STD_LOGIC := '0';
+    signal r_ADDRESS : STD_LOGIC_VECTOR (15 downto 0) := (others => '0');
+    signal r_DATA : STD_LOGIC_VECTOR (7 downto 0) := (others => '0');
+    signal r_WR : STD_LOGIC := '0';
+    signal w_data : STD_LOGIC_VECTOR (7 downto 0);
+    signal w_selected : STD_LOGIC;
+    signal w_interrupt : STD_LOGIC;
+
+    signal stop_the_clock : BOOLEAN := FALSE;
+
+begin
+
+    uut: Timer 
+      port map ( 
+        i_CLK => r_CLK,
+        i_ADDRESS => r_ADDRESS,
+        i_DATA => r_DATA,
+        i_WR => r_WR,
+        o_DATA => w_data,
+        o_SELECTED => w_selected,
+        o_INTERRUPT => w_interrupt
+      );
+
+
+    PROC_stim: process
+      variable v_cycles : NATURAL;
+      
+      procedure writeRegister(address : in NATURAL; data : in NATURAL) is
+      begin
+        wait until falling_edge(r_CLK);
+        r_ADDRESS <= STD_LOGIC_VECTOR(to_unsigned(address, 16));
+        r_DATA <= STD_LOGIC_VECTOR(to_unsigned(data, 8));
+        r_WR <= '1';
+        wait until falling_edge(r_CLK);
+        r_WR <= '0';
+      end procedure;
+      
+      procedure checkRegister(address : in NATURAL; data : in NATURAL) is
+      begin
+        r_ADDRESS <= STD_LOGIC_VECTOR(to_unsigned(address, 16));
+        wait for 1 ns;
+        assert(w_data = STD_LOGIC_VECTOR(to_unsigned(data, 8)))
+        report("Wrong content of timer register " & integer'image(address))
+        severity error;
+      end procedure;
+      
+    begin
+      -- address decoding
+      r_ADDRESS <= x"FDFF";
+      wait for 1 ns;
+      assert(w_selected = '0') report("0xFDFF selected") severity error;
+      r_ADDRESS <= x"FE06";
+      wait for 1 ns;
+      assert(w_selected = '0') report("0xFE06 selected") severity error;
+      r_ADDRESS <= x"FE05";
+      wait for 1 ns;
+      assert(w_selected = '1') report("0xFE05 not selected") severity error;
+      
+      -- auto-reload: period (3 + 1) * (1 + 1) = 8 clock cycles
+      writeRegister(16#FE01#, 1);
+      writeRegister(16#FE02#, 0);
+      writeRegister(16#FE03#, 3);
+      checkRegister(16#FE03#, 3);
+      writeRegister(16#FE00#, 16#07#);
+      
+      wait until rising_edge(w_interrupt);
+      for i in 1 to 3 loop
+        v_cycles := 0;
+        loop
+          wait until rising_edge(r_CLK);
+          wait for 1 ns;
+          v_cycles := v_cycles + 1;
+          exit when w_interrupt = '1';
+        end loop;
+        assert(v_cycles = 8)
+        report("Interrupt after " & integer'image(v_cycles) & " cycles")
+        severity error;
+      end loop;
+      checkRegister(16#FE00#, 16#87#); -- match flag
+      
+      -- stop (clears the flag), clear the counter, then one-shot
+      writeRegister(16#FE00#, 16#08#);
+      checkRegister(16#FE00#, 16#00#);
+      checkRegister(16#FE05#, 0);
+      writeRegister(16#FE00#, 16#05#);
+      wait until rising_edge(w_interrupt);
+      wait for 20 * g_clock_period;
+      checkRegister(16#FE00#, 16#84#); -- run cleared
+      checkRegister(16#FE04#, 0);
+      checkRegister(16#FE05#, 3);
+      assert(w_interrupt = '0') report("Interrupt not a pulse") severity error;
+      
+      report("Timer test finished!");
+      stop_the_clock <= TRUE;
+      wait;
+    end process PROC_stim;
+
+
+    PROC_clk: process
+    begin
+      while not stop_the_clock loop
+        r_CLK <= '0';
+        wait for g_clock_period/2;
+        r_CLK <= '1';
+        wait for g_clock_period/2;
+      end loop;
+      wait;
+    end process PROC_clk;
+
+end architecture;
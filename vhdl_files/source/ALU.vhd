@@ -33,34 +33,54 @@
 -- ALU (Arithmetic Logic Unit)
 ----------------------------------------------------------------------------------
 -- included part(s): 
---    SERIAL ADDER
+--    ADDER
 ----------------------------------------------------------------------------------
 -- Performs different operations using up to two operands. The operation is
 -- selected via a select line. Four clocked registers save flag conditions
 -- of the last operation (zero-flag, negative-flag, overflow-flag, carry-flag).
 -- The bus size of the ALU is a generic value (but it must be at least 4 as
 -- the flag-update instructions of the ALU affect the last four bits).
+-- The generic g_adder_style selects the implementation of the adder ("RIPPLE",
+-- "CLA", "CARRY_SELECT" or "KOGGE_STONE", see module "Adder"), the results
+-- and flags are the same for every style.
+-- Select 13 multiplies ALU_A and ALU_B (unsigned, g_bit x g_bit -> 2*g_bit),
+-- the output is the lower half of the product, the upper half is saved in a
+-- clocked register and is the output of select 15 (the microcode uses 15 as
+-- "no operation", it does not change the flags). Select 14 shifts ALU_A by 
+-- the amount in the lower bits of ALU_B (3 bits for 8 bit), the MSB of ALU_B
+-- selects the direction (0: left, 1: right).
+-- The flags and the upper half of the product are only loaded if i_ENABLE is
+-- set (the processor repeats a microinstruction whose RAM access was not 
+-- finished, which must not see its own flags).
 ----------------------------------------------------------------------------------
 
 library IEEE;
 use IEEE.STD_LOGIC_1164.ALL;
 use IEEE.std_logic_misc.ALL; -- includes or_reduce()
+use IEEE.NUMERIC_STD.ALL;
 
 
 entity ALU is
     Generic ( 
-      g_bit : positive -- bit size of operands (has to be be at least 4)
+      g_bit : positive; -- bit size of operands (has to be be at least 4)
+      g_adder_style : string := "RIPPLE"
     );
     Port ( 
       i_ALU_A : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
       i_ALU_B : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
       i_SEL : in STD_LOGIC_VECTOR (3 downto 0);      
       i_CLK : in STD_LOGIC; 
+      i_ENABLE : in STD_LOGIC := '1'; -- load the flag registers
       o_ALU_OUT : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
       o_Z_FLAG : out STD_LOGIC;
       o_N_FLAG : out STD_LOGIC;             
       o_V_FLAG : out STD_LOGIC; 
-      o_C_FLAG : out STD_LOGIC 
+      o_C_FLAG : out STD_LOGIC;
+      -- flag values that are loaded at the next clock edge (not registered)
+      o_Z_NEXT : out STD_LOGIC;
+      o_N_NEXT : out STD_LOGIC;
+      o_V_NEXT : out STD_LOGIC;
+      o_C_NEXT : out STD_LOGIC
     ); 
 end ALU;
 
@@ -68,9 +88,22 @@ end ALU;
 
 architecture Mixed of ALU is
 
-    component Serial_Adder is
+    -- number of bits for the shift amount (smallest n with 2**n >= g_bit)
+    function shift_bits (bits : positive) return positive is
+      variable v_n : positive := 1;
+    begin
+      while 2**v_n < bits loop
+        v_n := v_n + 1;
+      end loop;
+      return v_n;
+    end function;
+    
+    constant c_shift_bits : positive := shift_bits(g_bit);
+
+    component Adder is
       Generic ( 
-        g_bit: positive 
+        g_bit: positive;
+        g_adder_style : string
       );
       Port( 
         i_A, i_B : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
@@ -102,12 +135,24 @@ architecture Mixed of ALU is
     signal w_c_out_adder : STD_LOGIC;
     signal w_v_out_adder : STD_LOGIC;
     signal w_out_adder : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    
+    -- multiplier (upper half saved for select 15)
+    signal w_product : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+    signal r_PRODUCT_HIGH : STD_LOGIC_VECTOR (g_bit-1 downto 0) 
+        := (others => '0');
+    
+    -- barrel shifter, the carry is shifted together with ALU_A (the last bit
+    -- shifted out, unchanged for a shift by 0)
+    signal w_shift_amount : NATURAL range 0 to 2**c_shift_bits-1;
+    signal w_shift_left : STD_LOGIC_VECTOR (g_bit downto 0);
+    signal w_shift_right : STD_LOGIC_VECTOR (g_bit downto 0);
   
 begin
 
-    COMP_Adder: Serial_Adder
+    COMP_Adder: Adder
       generic map ( 
-        g_bit => g_bit 
+        g_bit => g_bit,
+        g_adder_style => g_adder_style
       )
       port map ( 
         i_A => i_ALU_A, 
@@ -122,18 +167,33 @@ begin
     -- Updates the status flags
     PROC_clk: process (i_CLK)
     begin
-      if(rising_edge(i_CLK)) then
-        r_Z_FLAG <= w_z_new;
-        r_N_FLAG <= w_n_new;
-        r_C_FLAG <= w_c_new;
-        r_V_FLAG <= w_v_new;
+      if rising_edge(i_CLK) then
+        if i_ENABLE = '1' then
+          r_Z_FLAG <= w_z_new;
+          r_N_FLAG <= w_n_new;
+          r_C_FLAG <= w_c_new;
+          r_V_FLAG <= w_v_new;
+          if i_SEL = "1101" then
+            r_PRODUCT_HIGH <= w_product(2*g_bit-1 downto g_bit);
+          end if;
+        end if;
       end if;
     end process PROC_clk;
 
 
+    w_product <= STD_LOGIC_VECTOR(UNSIGNED(i_ALU_A) * UNSIGNED(i_ALU_B));
+    
+    w_shift_amount <= to_integer(UNSIGNED(i_ALU_B(c_shift_bits-1 downto 0)));
+    w_shift_left <= STD_LOGIC_VECTOR(
+                      SHIFT_LEFT(UNSIGNED(r_C_FLAG & i_ALU_A), w_shift_amount));
+    w_shift_right <= STD_LOGIC_VECTOR(
+                       SHIFT_RIGHT(UNSIGNED(i_ALU_A & r_C_FLAG), w_shift_amount));
+
+
     PROC_output: process
       (i_ALU_A, i_ALU_B, i_SEL, w_z_calc, w_n_calc, w_out_adder, w_c_out_adder, 
-       w_v_out_adder, r_Z_FLAG, r_N_FLAG, r_C_FLAG, r_V_FLAG)
+       w_v_out_adder, r_Z_FLAG, r_N_FLAG, r_C_FLAG, r_V_FLAG, w_product,
+       r_PRODUCT_HIGH, w_shift_left, w_shift_right)
     begin   
       case i_SEL is   
         when "0000" =>      -- ALUout <= ALU_A
@@ -244,8 +304,30 @@ begin
           w_c_new <= r_C_FLAG;
           w_v_new <= r_V_FLAG;      
     
-        when others =>      -- (defined: ALUout <= '1' for all bits) 
-          w_alu_output <= (others => '1');
+        when "1101" =>      -- ALUout <= lower half of ALU_A * ALU_B
+          w_alu_output <= w_product(g_bit-1 downto 0);
+          
+          -- Z and N of the complete product, C: upper half is not zero
+          w_z_new <= NOT(or_reduce(w_product));
+          w_n_new <= w_product(2*g_bit-1);
+          w_c_new <= or_reduce(w_product(2*g_bit-1 downto g_bit));
+          w_v_new <= '0';
+          
+        when "1110" =>      -- ALUout <= ALU_A shifted by ALU_B 
+          if i_ALU_B(g_bit-1) = '0' then
+            w_alu_output <= w_shift_left(g_bit-1 downto 0);
+            w_c_new <= w_shift_left(g_bit);
+          else
+            w_alu_output <= w_shift_right(g_bit downto 1);
+            w_c_new <= w_shift_right(0);
+          end if;
+      
+          w_z_new <= w_z_calc;
+          w_n_new <= w_n_calc;
+          w_v_new <= '0';
+    
+        when others =>      -- ALUout <= upper half of the last product
+          w_alu_output <= r_PRODUCT_HIGH;
       
           w_z_new <= r_Z_FLAG;
           w_n_new <= r_N_FLAG;
@@ -264,6 +346,10 @@ begin
     o_N_FLAG <= r_N_FLAG;
     o_V_FLAG <= r_V_FLAG;
     o_C_FLAG <= r_C_FLAG;
+    o_Z_NEXT <= w_z_new;
+    o_N_NEXT <= w_n_new;
+    o_V_NEXT <= w_v_new;
+    o_C_NEXT <= w_c_new;
     o_ALU_OUT <= w_alu_output;
 
 end Mixed;
@@ -0,0 +1,261 @@
+-- BSD 3-Clause License
+-- 
+-- Copyright (c) 2018, Bernhard Vacarescu
+-- All rights reserved.
+-- 
+-- Redistribution and use in source and binary forms, with or without
+-- modification, are permitted provided that the following conditions are met:
+-- 
+-- * Redistributions of source code must retain the above copyright notice, this
+--   list of conditions and the following disclaimer.
+-- 
+-- * Redistributions in binary form must reproduce the above copyright notice,
+--   this list of conditions and the following disclaimer in the documentation
+--   and/or other materials provided with the distribution.
+-- 
+-- * Neither the name of the copyright holder nor the names of its
+--   contributors may be used to endorse or promote products derived from
+--   this software without specific prior written permission.
+-- 
+-- THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+-- AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+-- IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+-- DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+-- FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+-- DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+-- SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+-- CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+-- OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+-- OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------------------
+-- ADDER
+----------------------------------------------------------------------------------
+-- included part(s): 
+--    SERIAL ADDER
+----------------------------------------------------------------------------------
+-- Calculates the sum of two numbers (the bit-length is a generic value) with
+-- carry-input, carry-output and overflow-output like the serial adder. The
+-- generic g_adder_style selects how the carries are calculated:
+--    "RIPPLE": serial adder (chain of full adders), g_bit stages
+--    "CLA": carry-lookahead adder, groups of 4 bits. The group carries and the
+--           carries inside a group are two-level functions of the generate
+--           (A AND B) and propagate (A XOR B) signals.
+--    "CARRY_SELECT": groups of 4 bits, every group (except the first) 
+--           calculates its sum for carry-in 0 and 1, the carry of the previous
+--           group selects the result (one multiplexer per group on the path).
+--    "KOGGE_STONE": parallel prefix adder, log2(g_bit) stages of generate/
+--           propagate pairs with doubling distance.
+-- All styles have the same outputs for all inputs. The overflow-bit is the 
+-- XOR of the carries out of the two most significant bits.
+----------------------------------------------------------------------------------
+
+library IEEE;
+use IEEE.STD_LOGIC_1164.ALL;
+
+
+entity Adder is
+    Generic( 
+      g_bit : positive; -- has to be at least 2
+      g_adder_style : string := "RIPPLE"
+    );
+    Port( 
+      i_A, i_B : in STD_LOGIC_VECTOR (g_bit-1 downto 0); 
+      i_CARRY : in STD_LOGIC;           
+      o_CARRY : out STD_LOGIC;
+      o_V : out STD_LOGIC; 
+      o_Y : out STD_LOGIC_VECTOR (g_bit-1 downto 0)
+    );
+end Adder;
+
+
+
+architecture Mixed of Adder is
+
+    -- bit size of the groups (CLA and carry-select)
+    constant c_group_size : positive := 4;
+    constant c_groups : positive := (g_bit + c_group_size - 1) / c_group_size;
+
+    -- number of stages of the prefix adder (ceil(log2(g_bit)))
+    function stages (n : positive) return natural is
+      variable v_stages : natural := 0;
+    begin
+      while 2**v_stages < n loop
+        v_stages := v_stages + 1;
+      end loop;
+      return v_stages;
+    end function;
+    
+    constant c_stages : natural := stages(g_bit);
+    
+    -- generate and propagate of every bit
+    signal w_g : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_p : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    
+    -- w_carry(i): carry out of bit i (not used by "RIPPLE")
+    signal w_carry : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+
+begin
+
+    -- synthesis translate_off
+    assert (g_adder_style = "RIPPLE" OR g_adder_style = "CLA" OR 
+            g_adder_style = "CARRY_SELECT" OR g_adder_style = "KOGGE_STONE")
+    report("Generic error: g_adder_style has to be RIPPLE, CLA, " &
+           "CARRY_SELECT or KOGGE_STONE!")
+    severity failure;
+    -- synthesis translate_on
+
+    w_g <= i_A AND i_B;
+    w_p <= i_A XOR i_B;
+    
+    
+    ADDER_RIPPLE: if g_adder_style = "RIPPLE" generate
+    begin
+      Serial_Adder_inst: entity work.Serial_Adder
+        generic map ( 
+          g_bit => g_bit 
+        )
+        port map ( 
+          i_A => i_A, 
+          i_B => i_B, 
+          i_CARRY => i_CARRY,
+          o_CARRY => o_CARRY, 
+          o_V => o_V,
+          o_Y => o_Y 
+        );
+    end generate ADDER_RIPPLE;
+    
+    
+    ADDER_CLA: if g_adder_style = "CLA" generate
+    begin
+      PROC_carry: process (w_g, w_p, i_CARRY)
+        variable v_gg, v_gp : STD_LOGIC_VECTOR (c_groups-1 downto 0);
+        variable v_group_carry : STD_LOGIC_VECTOR (c_groups-1 downto 0);
+        variable v_carry : STD_LOGIC;
+        variable v_term : STD_LOGIC;
+      begin
+        -- group generate and group propagate
+        for k in 0 to c_groups-1 loop
+          v_gg(k) := '0';
+          v_gp(k) := '1';
+          for j in 0 to g_bit-1 loop
+            if j / c_group_size = k then
+              v_term := w_g(j);
+              for m in 0 to g_bit-1 loop
+                if (m > j) AND (m / c_group_size = k) then
+                  v_term := v_term AND w_p(m);
+                end if;
+              end loop;
+              v_gg(k) := v_gg(k) OR v_term;
+              v_gp(k) := v_gp(k) AND w_p(j);
+            end if;
+          end loop;
+        end loop;
+        
+        -- carry into every group (lookahead unit)
+        for k in 0 to c_groups-1 loop
+          v_carry := i_CARRY;
+          for m in 0 to k-1 loop
+            v_carry := v_carry AND v_gp(m);
+          end loop;
+          for j in 0 to k-1 loop
+            v_term := v_gg(j);
+            for m in j+1 to k-1 loop
+              v_term := v_term AND v_gp(m);
+            end loop;
+            v_carry := v_carry OR v_term;
+          end loop;
+          v_group_carry(k) := v_carry;
+        end loop;
+        
+        -- carries inside the groups
+        for i in 0 to g_bit-1 loop
+          v_carry := v_group_carry(i / c_group_size);
+          for m in 0 to i loop
+            if m / c_group_size = i / c_group_size then
+              v_carry := v_carry AND w_p(m);
+            end if;
+          end loop;
+          for j in 0 to i loop
+            if j / c_group_size = i / c_group_size then
+              v_term := w_g(j);
+              for m in j+1 to i loop
+                v_term := v_term AND w_p(m);
+              end loop;
+              v_carry := v_carry OR v_term;
+            end if;
+          end loop;
+          w_carry(i) <= v_carry;
+        end loop;
+      end process PROC_carry;
+    end generate ADDER_CLA;
+    
+    
+    ADDER_CARRY_SELECT: if g_adder_style = "CARRY_SELECT" generate
+    begin
+      PROC_carry: process (w_g, w_p, i_CARRY)
+        -- carries of the groups for carry-in 0 and carry-in 1
+        variable v_carry_0, v_carry_1 : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+        variable v_group_carry : STD_LOGIC;
+      begin
+        for i in 0 to g_bit-1 loop
+          if i mod c_group_size = 0 then
+            -- first bit of a group
+            v_carry_0(i) := w_g(i);
+            v_carry_1(i) := w_g(i) OR w_p(i);
+          else
+            v_carry_0(i) := w_g(i) OR (w_p(i) AND v_carry_0(i-1));
+            v_carry_1(i) := w_g(i) OR (w_p(i) AND v_carry_1(i-1));
+          end if;
+        end loop;
+        
+        -- selection by the carry out of the previous group
+        v_group_carry := i_CARRY;
+        for i in 0 to g_bit-1 loop
+          if v_group_carry = '1' then
+            w_carry(i) <= v_carry_1(i);
+          else
+            w_carry(i) <= v_carry_0(i);
+          end if;
+          if (i mod c_group_size = c_group_size-1) AND (i < g_bit-1) then
+            if v_group_carry = '1' then
+              v_group_carry := v_carry_1(i);
+            else
+              v_group_carry := v_carry_0(i);
+            end if;
+          end if;
+        end loop;
+      end process PROC_carry;
+    end generate ADDER_CARRY_SELECT;
+    
+    
+    ADDER_KOGGE_STONE: if g_adder_style = "KOGGE_STONE" generate
+    begin
+      PROC_carry: process (w_g, w_p, i_CARRY)
+        variable v_g, v_p : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+      begin
+        v_g := w_g;
+        v_p := w_p;
+        -- carry-in is included into the generate of bit 0
+        v_g(0) := w_g(0) OR (w_p(0) AND i_CARRY);
+        for s in 0 to c_stages-1 loop
+          -- downwards: (i - 2**s) still holds the value of the previous stage
+          for i in g_bit-1 downto 2**s loop
+            v_g(i) := v_g(i) OR (v_p(i) AND v_g(i - 2**s));
+            v_p(i) := v_p(i) AND v_p(i - 2**s);
+          end loop;
+        end loop;
+        w_carry <= v_g;
+      end process PROC_carry;
+    end generate ADDER_KOGGE_STONE;
+    
+    
+    -- sum and flags of the styles with calculated carries
+    ADDER_CARRIES: if g_adder_style /= "RIPPLE" generate
+    begin
+      o_Y <= w_p XOR (w_carry(g_bit-2 downto 0) & i_CARRY);
+      o_V <= w_carry(g_bit-1) XOR w_carry(g_bit-2);
+      o_CARRY <= w_carry(g_bit-1);
+    end generate ADDER_CARRIES;
+
+end Mixed;
@@ -36,25 +36,70 @@
 -- external RAM. Depending on the control bits the MAR can be loaded
 -- with an address and the MBR can be loaded from the ALU (to store the content 
 -- to RAM) or read from RAM into MBR.
+-- Control bits (MBR MAR RD WR):
+--    0000:             no memory operation
+--    0110, 1010:       read (MAR <- B,A; then MBR <- M[MAR])
+--    0100, 1001, 0001: write (MAR <- B,A; then MBR <- ALU; then M[MAR] <- MBR)
+--    1110:             take next byte (MAR <- B,A and MBR <- M[MAR] in one
+--                      step, the address is taken directly from the A- and
+--                      B-latch)
+--    0010:             MAR <- MAR + 1 (16 bit, carry from MAR L to MAR H)
+--    0011:             MAR <- MAR - 1 (16 bit, borrow from MAR L to MAR H)
+-- The MAR steps (0010, 0011) do not access the RAM. They can be used instead
+-- of the first step of a read or a write, so consecutive bytes (e.g. the
+-- second byte of a 16 bit operand or the next stack byte) are addressed 
+-- without loading the MAR from the registers (post-increment after a read,
+-- pre-decrement before a write).
+-- A take is served by the prefetch queue if the queue holds the byte of this
+-- address, otherwise the byte is read from the RAM. In every step without a 
+-- memory operation (0000) the queue reads the following byte from the RAM 
+-- (o_QUEUE_RD). A take from another address (jump) restarts the queue, a 
+-- write clears it only if it changes one of the queued bytes (address in 
+-- the window of the queue).
+-- Writes of the RAM that do not come from this module (DMA, second processor)
+-- are snooped: i_SNOOP_WR and i_SNOOP_ADDRESS are the write of the RAM port,
+-- taken at the edge of i_CLK_MEMORY (the write itself), and clear the queue 
+-- at the next edge of i_CLK_MBR if the address is in the window (a take at 
+-- this edge still gets the old byte, like a RAM read in the same cycle). The
+-- addresses are compared with all 2*g_bit bits (a write to a mirror of a 
+-- smaller RAM is not seen).
+-- The MBR and the queue are only loaded if i_ENABLE is set (cleared by the
+-- processor if the RAM access of the microcycle was not finished, the step is
+-- then repeated). A read of the queue does not hold the processor: it is only
+-- kept if i_QUEUE_READY is set (RAM ready), otherwise it is dropped and the 
+-- byte is read again in the next step without memory operation.
+-- g_queue_depth: number of bytes in the prefetch queue (0: no queue, every
+--    take reads from the RAM)
 ----------------------------------------------------------------------------------
 
 library IEEE;
 use IEEE.STD_LOGIC_1164.ALL;
+use IEEE.NUMERIC_STD.ALL;
 
 
 entity Communication is
     Generic ( 
-      g_bit : positive 
+      g_bit : positive;
+      g_queue_depth : natural := 4
     );
     Port ( 
       i_CLK_MAR : in STD_LOGIC; -- CLK3
       i_CLK_MBR : in STD_LOGIC; -- CLK4
+      i_CLK_MEMORY : in STD_LOGIC := '0'; -- clock of the RAM (snoop)
+      i_ENABLE : in STD_LOGIC := '1'; -- load MBR and queue
+      i_QUEUE_READY : in STD_LOGIC := '1'; -- RAM read of the queue done
       i_CONTROL : in STD_LOGIC_VECTOR (3 downto 0); -- MBR MAR RD WR
       i_DATA_FROM_ALU : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
       i_A_REG : in STD_LOGIC_VECTOR (g_bit-1 downto 0); -- laod MAR L
       i_B_REG : in STD_LOGIC_VECTOR (g_bit-1 downto 0); -- load MAR H
       o_DATA_TO_AMUX : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
       o_ADDRESS : out STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+      o_QUEUE_RD : out STD_LOGIC; -- RAM read of the prefetch queue
+      o_QUEUE_HIT : out STD_LOGIC; -- take served by the queue (no RAM read)
+      -- write of the RAM port (all masters)
+      i_SNOOP_WR : in STD_LOGIC := '0';
+      i_SNOOP_ADDRESS : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0) 
+          := (others => '0');
       io_DATA_MEM : inout STD_LOGIC_VECTOR (g_bit-1 downto 0) -- from/to RAM
     );
 end Communication;
@@ -72,6 +117,20 @@ architecture Behavioral of Communication is
     alias i_MAR_MIR : STD_LOGIC is i_CONTROL(2);
     alias i_RD_MIR : STD_LOGIC is i_CONTROL(1);
     alias i_WR_MIR : STD_LOGIC is i_CONTROL(0);
+    
+    -- address of a take (A- and B-latch)
+    signal w_take_address : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+    signal w_take : STD_LOGIC;
+    
+    -- write to RAM (0001 like o_WR of the processor, 0011 is the MAR 
+    -- decrement, in 1001 the MBR is loaded from the ALU)
+    signal w_write : STD_LOGIC;
+    
+    -- prefetch queue
+    signal w_queue_hit : STD_LOGIC;
+    signal w_queue_rd : STD_LOGIC;
+    signal w_queue_head : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_queue_address : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
 
 begin
 
@@ -88,7 +147,9 @@ begin
       assert( 
         (v_new_control = "0000") OR (v_new_control = "0110") OR
         (v_new_control = "1010") OR (v_new_control = "0100") OR
-        (v_new_control = "1001") OR (v_new_control = "0001") )
+        (v_new_control = "1001") OR (v_new_control = "0001") OR
+        (v_new_control = "1110") OR (v_new_control = "0010") OR
+        (v_new_control = "0011") )
       report("Microde error: illegal read/write microcode")
       severity(error);
       
@@ -110,6 +171,14 @@ begin
         severity(error);
       end if;
       
+      -- the second step of a write needs a new MAR (load or step)
+      if v_new_control = "1001" then
+        assert( (v_old_control = "0100") OR (v_old_control = "0010") OR
+                (v_old_control = "0011") )
+        report("Microde error: write not performed correctly")
+        severity(error);
+      end if;
+      
     end process PROC_sim_check;
     -- synthesis translate_on
   
@@ -121,6 +190,12 @@ begin
         if i_MAR_MIR = '1' then
           r_MAR_H <= i_B_REG;
           r_MAR_L <= i_A_REG;
+        elsif i_MBR_MIR = '0' AND i_RD_MIR = '1' then
+          if i_WR_MIR = '0' then -- 0010
+            r_MAR <= STD_LOGIC_VECTOR(UNSIGNED(r_MAR) + 1);
+          else -- 0011
+            r_MAR <= STD_LOGIC_VECTOR(UNSIGNED(r_MAR) - 1);
+          end if;
         end if;
       end if;
     end process PROC_MAR;   
@@ -129,8 +204,10 @@ begin
     PROC_MBR: process (i_CLK_MBR)
     begin
       if rising_edge(i_CLK_MBR) then
-        if i_MBR_MIR = '1' then
-          if i_RD_MIR = '1' then
+        if i_MBR_MIR = '1' AND i_ENABLE = '1' then
+          if w_queue_hit = '1' then
+            r_MBR <= w_queue_head;
+          elsif i_RD_MIR = '1' then
             r_MBR <= io_DATA_MEM;
           elsif i_WR_MIR = '1' then
             r_MBR <= i_DATA_FROM_ALU;
@@ -140,10 +217,105 @@ begin
       end if;
     end process PROC_MBR;
 
+    w_take <= '1' when i_CONTROL = "1110" else '0';
+    w_write <= i_WR_MIR AND NOT(i_RD_MIR) AND NOT(i_MBR_MIR);
+    w_take_address <= i_B_REG & i_A_REG;
+    
+    
+    QUEUE: if g_queue_depth > 0 generate
+      type t_QUEUE is array (0 to g_queue_depth-1) 
+          of STD_LOGIC_VECTOR (g_bit-1 downto 0);
+      
+      signal r_QUEUE : t_QUEUE := (others => (others => '0'));
+      -- address of the first byte in the queue
+      signal r_QUEUE_ADDRESS : UNSIGNED (2*g_bit-1 downto 0) 
+          := (others => '0');
+      signal r_QUEUE_COUNT : natural range 0 to g_queue_depth := 0;
+      -- no prefetch before the first take
+      signal r_QUEUE_ACTIVE : STD_LOGIC := '0';
+      
+      -- write of a queued byte (offset of the MAR from the first byte, 
+      -- modulo the address space)
+      signal w_write_offset : UNSIGNED (2*g_bit-1 downto 0);
+      signal w_write_hit : STD_LOGIC;
+      
+      -- snooped write of the RAM port (last edge of i_CLK_MEMORY)
+      signal r_SNOOP_WR : STD_LOGIC := '0';
+      signal r_SNOOP_ADDRESS : UNSIGNED (2*g_bit-1 downto 0) 
+          := (others => '0');
+      signal w_snoop_offset : UNSIGNED (2*g_bit-1 downto 0);
+      signal w_snoop_hit : STD_LOGIC;
+    begin
+      w_queue_hit <= '1' when w_take = '1' AND r_QUEUE_COUNT > 0 AND
+                              r_QUEUE_ADDRESS = UNSIGNED(w_take_address)
+                     else '0';
+      w_queue_rd <= '1' when i_CONTROL = "0000" AND r_QUEUE_ACTIVE = '1' AND
+                             r_QUEUE_COUNT < g_queue_depth
+                    else '0';
+      w_queue_head <= r_QUEUE(0);
+      w_write_offset <= UNSIGNED(r_MAR) - r_QUEUE_ADDRESS;
+      w_write_hit <= '1' when w_write = '1' AND 
+                              w_write_offset < r_QUEUE_COUNT
+                     else '0';
+      w_snoop_offset <= r_SNOOP_ADDRESS - r_QUEUE_ADDRESS;
+      w_snoop_hit <= '1' when r_SNOOP_WR = '1' AND 
+                              w_snoop_offset < r_QUEUE_COUNT
+                     else '0';
+      w_queue_address <= STD_LOGIC_VECTOR(r_QUEUE_ADDRESS + r_QUEUE_COUNT);
+      
+      PROC_SNOOP: process (i_CLK_MEMORY)
+      begin
+        if rising_edge(i_CLK_MEMORY) then
+          r_SNOOP_WR <= i_SNOOP_WR;
+          r_SNOOP_ADDRESS <= UNSIGNED(i_SNOOP_ADDRESS);
+        end if;
+      end process PROC_SNOOP;
+    
+      PROC_QUEUE: process (i_CLK_MBR)
+      begin
+        if rising_edge(i_CLK_MBR) then
+          -- the queue may also be cleared while the processor waits
+          if w_snoop_hit = '1' then
+            r_QUEUE_COUNT <= 0;
+          elsif i_ENABLE = '0' then
+            null;
+          elsif w_write_hit = '1' then
+            r_QUEUE_COUNT <= 0;
+          elsif w_take = '1' then
+            r_QUEUE_ACTIVE <= '1';
+            r_QUEUE_ADDRESS <= UNSIGNED(w_take_address) + 1;
+            if w_queue_hit = '1' then
+              for i in 0 to g_queue_depth-2 loop
+                r_QUEUE(i) <= r_QUEUE(i+1);
+              end loop;
+              r_QUEUE_COUNT <= r_QUEUE_COUNT - 1;
+            else
+              r_QUEUE_COUNT <= 0;
+            end if;
+          elsif w_queue_rd = '1' AND i_QUEUE_READY = '1' then
+            r_QUEUE(r_QUEUE_COUNT) <= io_DATA_MEM;
+            r_QUEUE_COUNT <= r_QUEUE_COUNT + 1;
+          end if;
+        end if;
+      end process PROC_QUEUE;
+    end generate QUEUE;
+    
+    NO_QUEUE: if g_queue_depth = 0 generate
+      w_queue_hit <= '0';
+      w_queue_rd <= '0';
+      w_queue_head <= (others => '0');
+      w_queue_address <= (others => '0');
+    end generate NO_QUEUE;
+    
+
     -- tristate logic
-    io_DATA_MEM <= r_MBR when i_WR_MIR = '1' else (others => 'Z');
+    io_DATA_MEM <= r_MBR when w_write = '1' else (others => 'Z');
     
     o_DATA_TO_AMUX <= r_MBR;
-    o_ADDRESS <= r_MAR;
+    o_ADDRESS <= w_take_address when w_take = '1' else
+                 w_queue_address when w_queue_rd = '1' else
+                 r_MAR;
+    o_QUEUE_RD <= w_queue_rd;
+    o_QUEUE_HIT <= w_queue_hit;
   
 end Behavioral;
@@ -0,0 +1,248 @@
+-- BSD 3-Clause License
+-- 
+-- Copyright (c) 2018, Bernhard Vacarescu
+-- All rights reserved.
+-- 
+-- Redistribution and use in source and binary forms, with or without
+-- modification, are permitted provided that the following conditions are met:
+-- 
+-- * Redistributions of source code must retain the above copyright notice, this
+--   list of conditions and the following disclaimer.
+-- 
+-- * Redistributions in binary form must reproduce the above copyright notice,
+--   this list of conditions and the following disclaimer in the documentation
+--   and/or other materials provided with the distribution.
+-- 
+-- * Neither the name of the copyright holder nor the names of its
+--   contributors may be used to endorse or promote products derived from
+--   this software without specific prior written permission.
+-- 
+-- THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+-- AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+-- IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+-- DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+-- FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+-- DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+-- SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+-- CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+-- OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+-- OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+----------------------------------------------------------------------------------
+-- DMA
+----------------------------------------------------------------------------------
+-- Block copy engine that shares the RAM port with the processor. The 
+-- registers are placed at g_base_address (offset, g_bit bit each):
+--    0  CTRL  bit 0: start (write 1)/busy (read), bit 2: interrupt enable, 
+--             bit 7: done flag (read only, cleared by every write of CTRL)
+--    1  SRCH  source address (2*g_bit bit, counts up while copying)
+--    2  SRCL
+--    3  DSTH  destination address (2*g_bit bit, counts up while copying)
+--    4  DSTL
+--    5  LENH  number of words (2*g_bit bit, counts down to 0 while copying)
+--    6  LENL
+-- The register bus is the one of the RAM (like "Timer"): i_WR writes i_DATA 
+-- at the rising edge of i_CLK (o_CLK_MEMORY of the processor), o_DATA is the
+-- content of the addressed register (asynchronous), o_SELECTED is set if 
+-- i_ADDRESS is one of the registers (the RAM must not answer then).
+-- The copy only uses memory cycles in which the processor does not access 
+-- the RAM (i_RD and i_WR are 0 at the rising edge of i_CLK). Then 
+-- o_RAM_ENABLE is set and the RAM has to use o_RAM_ADDRESS instead of the
+-- address of the processor (o_RAM_WRITE: write o_RAM_DATA). The RAM is 
+-- expected to be synchronous: the word read at a rising edge is at 
+-- i_RAM_DATA until the next rising edge, where it is taken (and written at 
+-- once if the cycle is free again). So a word needs at least 2 free memory 
+-- cycles. A processor with a prefetch queue does not see these writes on its
+-- bus, so o_RAM_WRITE and o_RAM_ADDRESS have to be connected to its snoop 
+-- inputs (i_SNOOP_WR, i_SNOOP_ADDRESS) if the DMA may copy program code.
+-- After the last word the done flag is set and, if the interrupt is enabled,
+-- o_INTERRUPT for one clock cycle (for a line that is not debounced, see 
+-- "Timer"). The registers should not be written while the DMA is busy (CTRL
+-- with start 0 aborts the copy). SRC + LEN and DST + LEN must stay inside the
+-- RAM: o_RAM_ADDRESS bypasses the decoding of the registers (of this DMA, 
+-- the timer, ...), and a RAM that only uses the lower address bits (e.g. in
+-- "Processor_Controller") would wrap the block to its start.
+----------------------------------------------------------------------------------
+
+library IEEE;
+use IEEE.STD_LOGIC_1164.ALL;
+use IEEE.NUMERIC_STD.ALL;
+
+
+entity DMA is
+    Generic ( 
+      g_bit : positive := 8; -- data bus (address bus: 2*g_bit)
+      g_base_address : natural := 16#FE08#
+    );
+    Port ( 
+      i_CLK : in STD_LOGIC;
+      -- register access and RAM usage of the processor
+      i_ADDRESS : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+      i_DATA : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
+      i_RD : in STD_LOGIC;
+      i_WR : in STD_LOGIC;
+      o_DATA : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+      o_SELECTED : out STD_LOGIC;
+      -- RAM port
+      i_RAM_DATA : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
+      o_RAM_ADDRESS : out STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+      o_RAM_DATA : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+      o_RAM_ENABLE : out STD_LOGIC;
+      o_RAM_WRITE : out STD_LOGIC;
+      o_INTERRUPT : out STD_LOGIC -- pulse
+    );
+end DMA;
+
+
+
+architecture Behavioral of DMA is
+
+    -- register offsets
+    constant c_ctrl : natural := 0;
+    constant c_src_h : natural := 1;
+    constant c_src_l : natural := 2;
+    constant c_dst_h : natural := 3;
+    constant c_dst_l : natural := 4;
+    constant c_len_h : natural := 5;
+    constant c_len_l : natural := 6;
+    
+    -- s_read: next free cycle reads M[SRC]
+    -- s_take: word at i_RAM_DATA, written if the cycle is free
+    -- s_write: word in r_BUFFER, written in the next free cycle
+    type t_state is (s_idle, s_read, s_take, s_write);
+    signal r_STATE : t_state := s_idle;
+    
+    signal r_INT_ENABLE : STD_LOGIC := '0';
+    signal r_FLAG : STD_LOGIC := '0';
+    signal r_INTERRUPT : STD_LOGIC := '0';
+    
+    signal r_SOURCE : UNSIGNED (2*g_bit-1 downto 0) := (others => '0');
+    signal r_DESTINATION : UNSIGNED (2*g_bit-1 downto 0) := (others => '0');
+    signal r_LENGTH : UNSIGNED (2*g_bit-1 downto 0) := (others => '0');
+    signal r_BUFFER : STD_LOGIC_VECTOR (g_bit-1 downto 0) := (others => '0');
+    
+    signal w_busy : STD_LOGIC;
+    signal w_free : STD_LOGIC; -- processor does not access the RAM
+    signal w_ram_write : STD_LOGIC;
+    
+    -- offset of the addressed register (only valid if w_selected is set)
+    signal w_offset : natural range 0 to 7;
+    signal w_selected : STD_LOGIC;
+    signal w_write : STD_LOGIC;
+
+begin
+
+    w_selected <= '1' when (UNSIGNED(i_ADDRESS) >= g_base_address AND
+                            UNSIGNED(i_ADDRESS) <= g_base_address + c_len_l)
+                  else '0';
+    w_offset <= to_integer(UNSIGNED(i_ADDRESS) - g_base_address) 
+                  when w_selected = '1' else 0;
+    w_write <= i_WR AND w_selected;
+    
+    w_busy <= '0' when r_STATE = s_idle else '1';
+    w_free <= NOT(i_RD OR i_WR);
+    w_ram_write <= '1' when (r_STATE = s_take OR r_STATE = s_write) AND 
+                            w_free = '1' else '0';
+    
+    
+    PROC_dma: process (i_CLK)
+    begin
+      if rising_edge(i_CLK) then
+        r_INTERRUPT <= '0';
+        
+        -- copy
+        case r_STATE is
+          when s_idle =>
+            null;
+          when s_read =>
+            if r_LENGTH = 0 then
+              r_STATE <= s_idle;
+              r_FLAG <= '1';
+              r_INTERRUPT <= r_INT_ENABLE;
+            elsif w_free = '1' then
+              r_SOURCE <= r_SOURCE + 1;
+              r_STATE <= s_take;
+            end if;
+          when s_take =>
+            r_BUFFER <= i_RAM_DATA;
+            r_STATE <= s_write;
+          when s_write =>
+            null;
+        end case;
+        if w_ram_write = '1' then
+          r_DESTINATION <= r_DESTINATION + 1;
+          r_LENGTH <= r_LENGTH - 1;
+          r_STATE <= s_read;
+        end if;
+        
+        -- bus write (has priority)
+        if w_write = '1' then
+          case w_offset is
+            when c_ctrl =>
+              r_INT_ENABLE <= i_DATA(2);
+              r_FLAG <= '0';
+              if i_DATA(0) = '1' then
+                r_STATE <= s_read;
+              else
+                r_STATE <= s_idle;
+              end if;
+            when c_src_h =>
+              r_SOURCE(2*g_bit-1 downto g_bit) <= UNSIGNED(i_DATA);
+            when c_src_l =>
+              r_SOURCE(g_bit-1 downto 0) <= UNSIGNED(i_DATA);
+            when c_dst_h =>
+              r_DESTINATION(2*g_bit-1 downto g_bit) <= UNSIGNED(i_DATA);
+            when c_dst_l =>
+              r_DESTINATION(g_bit-1 downto 0) <= UNSIGNED(i_DATA);
+            when c_len_h =>
+              r_LENGTH(2*g_bit-1 downto g_bit) <= UNSIGNED(i_DATA);
+            when c_len_l =>
+              r_LENGTH(g_bit-1 downto 0) <= UNSIGNED(i_DATA);
+            when others =>
+              null;
+          end case;
+        end if;
+      end if;
+    end process PROC_dma;
+    
+    
+    -- read access
+    PROC_read: process (w_offset, w_busy, r_INT_ENABLE, r_FLAG, r_SOURCE,
+        r_DESTINATION, r_LENGTH)
+    begin
+      o_DATA <= (others => '0');
+      case w_offset is
+        when c_ctrl =>
+          o_DATA(0) <= w_busy;
+          o_DATA(2) <= r_INT_ENABLE;
+          o_DATA(7) <= r_FLAG;
+        when c_src_h =>
+          o_DATA <= STD_LOGIC_VECTOR(r_SOURCE(2*g_bit-1 downto g_bit));
+        when c_src_l =>
+          o_DATA <= STD_LOGIC_VECTOR(r_SOURCE(g_bit-1 downto 0));
+        when c_dst_h =>
+          o_DATA <= STD_LOGIC_VECTOR(r_DESTINATION(2*g_bit-1 downto g_bit));
+        when c_dst_l =>
+          o_DATA <= STD_LOGIC_VECTOR(r_DESTINATION(g_bit-1 downto 0));
+        when c_len_h =>
+          o_DATA <= STD_LOGIC_VECTOR(r_LENGTH(2*g_bit-1 downto g_bit));
+        when c_len_l =>
+          o_DATA <= STD_LOGIC_VECTOR(r_LENGTH(g_bit-1 downto 0));
+        when others =>
+          null;
+      end case;
+    end process PROC_read;
+    
+    -- RAM port (read in s_read, write in s_take and s_write)
+    o_RAM_ADDRESS <= STD_LOGIC_VECTOR(r_SOURCE) when r_STATE = s_read else
+                     STD_LOGIC_VECTOR(r_DESTINATION);
+    o_RAM_DATA <= i_RAM_DATA when r_STATE = s_take else r_BUFFER;
+    o_RAM_ENABLE <= '1' when (r_STATE = s_read AND r_LENGTH /= 0 AND 
+                              w_free = '1') OR w_ram_write = '1' else '0';
+    o_RAM_WRITE <= w_ram_write;
+    
+    o_SELECTED <= w_selected;
+    o_INTERRUPT <= r_INTERRUPT;
+
+end Behavioral;
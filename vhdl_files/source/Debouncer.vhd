@@ -44,6 +44,13 @@
 -- value g_bit_size_counter  (g_bit_size_counter-1 downto 0). The additional bit 
 -- is used as a carry-output of the counter to indicate when a counter
 -- overflow occurs. Max. counter value: 2**g_bit_size_counter-1
+-- The counter only counts if i_TICK is 1. Without a connection it counts 
+-- every clock cycle (debounce time 2**g_bit_size_counter clock cycles). The
+-- "Event_Controller" connects a tick of a shared prescaler instead, so that
+-- every line only needs a small counter. The first tick after a change of 
+-- the input comes 1 clock cycle to one prescaler period later, so it counts
+-- g_extra_ticks = 1 more tick (2**g_bit_size_counter + 1 ticks, at least 
+-- 2**g_bit_size_counter prescaler periods).
 ----------------------------------------------------------------------------------
 
 library IEEE;
@@ -53,11 +60,13 @@ use IEEE.NUMERIC_STD.ALL;
 
 entity Debouncer is
     Generic ( 
-      g_bit_size_counter : positive
+      g_bit_size_counter : positive;
+      g_extra_ticks : natural := 0 -- counted after 2**g_bit_size_counter
     ); 
     Port ( 
       i_IN : in STD_LOGIC;
       i_CLK : in STD_LOGIC;
+      i_TICK : in STD_LOGIC := '1'; -- counter enable
       o_OUT : out STD_LOGIC
     );
 end Debouncer;
@@ -76,8 +85,18 @@ architecture Behavioral of Debouncer is
     signal r_COUNT : STD_LOGIC_VECTOR(g_bit_size_counter downto 0) 
       := (others => '0');
     
+    -- counter value that enables the output
+    constant c_limit : positive := 2**g_bit_size_counter + g_extra_ticks;
+    
 begin
 
+    -- synthesis translate_off
+    assert (g_extra_ticks < 2**g_bit_size_counter)
+    report("Generic error: g_extra_ticks has to be smaller than " &
+           "2**g_bit_size_counter!")
+    severity failure;
+    -- synthesis translate_on
+
     process (i_CLK)
     begin
       if rising_edge(i_CLK) then
@@ -88,14 +107,16 @@ begin
         if w_clear_counter = '1' then
           r_COUNT <= (others => '0');
         elsif w_output_en /= '1' then
-          r_COUNT <= STD_LOGIC_VECTOR(UNSIGNED(r_COUNT) + 1);
+          if i_TICK = '1' then
+            r_COUNT <= STD_LOGIC_VECTOR(UNSIGNED(r_COUNT) + 1);
+          end if;
         else
           r_FF3_OUT <= r_FF2_OUT;
         end if;      
       end if;
     end process;
     
-    w_output_en <= r_COUNT(g_bit_size_counter);
+    w_output_en <= '1' when UNSIGNED(r_COUNT) = c_limit else '0';
     w_clear_counter <= r_FF1_OUT XOR r_FF2_OUT;
     
     o_OUT  <= r_FF3_OUT;
@@ -46,6 +46,25 @@
 -- If more events occur at the same time, only the event with the highest 
 -- priority encodes the output. The higher the clock-speed, the less the 
 -- possibility that an event is missed. 
+-- The pulses of the interrupt lines are also output separately (o_INTERRUPT),
+-- so that a following module (e.g. "Interrupt_Controller") can latch every
+-- event.
+-- The generic g_debounce_style selects how the lines are debounced:
+--   "COUNTER": every line has its own counter of g_bit_size_counter bits 
+--              (debounce time 2**g_bit_size_counter clock cycles)
+--   "SHARED":  one prescaler of g_bit_size_counter - g_tick_bits bits for all
+--              lines generates a tick, every line only counts 
+--              2**g_tick_bits + 1 ticks (g_tick_bits + 1 bit counter). The 
+--              prescaler is not aligned to the input change, so the first
+--              tick comes 1 clock cycle to one prescaler period after it and
+--              the debounce time is 2**g_bit_size_counter clock cycles plus
+--              up to one prescaler period (never shorter than "COUNTER"). If
+--              g_bit_size_counter <= g_tick_bits there is no prescaler and 
+--              the lines count every clock cycle.
+-- The benchmark "debounce_synthesis.sh" compares the area of both styles.
+-- The last g_direct_lines interrupt lines are not debounced (only 
+-- synchronized and edge detected), they are meant for internal peripherals
+-- (e.g. "Timer") whose request is a pulse of one clock cycle.
 ----------------------------------------------------------------------------------
 
 library IEEE;
@@ -57,12 +76,16 @@ entity Event_Controller is
     Generic ( 
       g_bit_size_counter : positive;  -- for debouncer
       g_bit_size : positive; -- bit size of output
-      g_int_lines : positive
+      g_int_lines : positive;
+      g_debounce_style : string := "SHARED"; -- "SHARED" or "COUNTER"
+      g_tick_bits : positive := 3; -- per-line counter of "SHARED"
+      g_direct_lines : natural := 0 -- last lines without debouncer
     );
     Port ( 
       i_RESET : in STD_LOGIC;
       i_CLK : in STD_LOGIC;
       i_INTERRUPT : in STD_LOGIC_VECTOR (1 to g_int_lines);
+      o_INTERRUPT : out STD_LOGIC_VECTOR (1 to g_int_lines); -- pulses
       o_EVENT_CONTROL : out STD_LOGIC_VECTOR (g_bit_size-1 downto 0) 
     );
 end Event_Controller;
@@ -73,11 +96,13 @@ architecture Mixed of Event_Controller is
 
     component Debouncer
       Generic ( 
-        g_bit_size_counter : positive
+        g_bit_size_counter : positive;
+        g_extra_ticks : natural := 0
       );
       Port ( 
         i_IN : in STD_LOGIC;
         i_CLK : in STD_LOGIC;
+        i_TICK : in STD_LOGIC;
         o_OUT : out STD_LOGIC 
       );
     end component;
@@ -106,9 +131,47 @@ architecture Mixed of Event_Controller is
     
     -- connection between synchronizer and debouncer
     signal w_connect_sd : STD_LOGIC_VECTOR (0 to g_int_lines);
+    
+    -- bit size of the debouncer counter of every line
+    function lineCounterBits return positive is
+    begin
+      if (g_debounce_style = "SHARED") AND (g_bit_size_counter > g_tick_bits)
+      then
+        return g_tick_bits;
+      else
+        return g_bit_size_counter;
+      end if;
+    end function;
+    
+    constant c_line_counter_bits : positive := lineCounterBits;
+    constant c_prescaler_bits : natural := 
+      g_bit_size_counter - c_line_counter_bits;
+    -- one more tick for the first (shortened) prescaler period
+    constant c_extra_ticks : natural := BOOLEAN'POS(c_prescaler_bits > 0);
+    
+    -- shared prescaler ("SHARED"), w_tick enables the debouncer counters
+    signal r_PRESCALER : UNSIGNED (c_prescaler_bits-1 downto 0) 
+      := (others => '0');
+    signal w_tick : STD_LOGIC;
 
 begin
 
+    PRESCALER: if c_prescaler_bits > 0 generate
+      PROC_prescaler: process (i_CLK)
+      begin
+        if rising_edge(i_CLK) then
+          r_PRESCALER <= r_PRESCALER + 1;
+        end if;
+      end process PROC_prescaler;
+      
+      w_tick <= '1' when r_PRESCALER = (r_PRESCALER'range => '1') else '0';
+    end generate PRESCALER;
+    
+    NO_PRESCALER: if c_prescaler_bits = 0 generate
+      w_tick <= '1';
+    end generate NO_PRESCALER;
+
+
     CON: for i in 0 to g_int_lines generate
       START: if(i = 0) generate  
        RESET: Synchronizer 
@@ -119,11 +182,13 @@ begin
          );              
         RESET1: Debouncer 
           generic map ( 
-            g_bit_size_counter => g_bit_size_counter
+            g_bit_size_counter => c_line_counter_bits,
+            g_extra_ticks => c_extra_ticks
           )
           port map ( 
             i_IN => w_connect_sd(i),
             i_CLK => i_CLK,
+            i_TICK => w_tick,
             o_OUT => w_connect_de(i)
           );
         RESET2: Edge_Detection
@@ -133,7 +198,7 @@ begin
             o_OUT => w_priority_in(i)
           );
       end generate;
-      REST: if(i >0) AND (i <= g_int_lines) generate
+      REST: if(i >0) AND (i <= g_int_lines - g_direct_lines) generate
         INT: Synchronizer 
         port map ( 
           i_IN => i_INTERRUPT(i),
@@ -142,11 +207,13 @@ begin
         );  
         INT1: Debouncer
           generic map ( 
-            g_bit_size_counter => g_bit_size_counter
+            g_bit_size_counter => c_line_counter_bits,
+            g_extra_ticks => c_extra_ticks
           )
           port map ( 
             i_IN => w_connect_sd(i),
             i_CLK => i_CLK,
+            i_TICK => w_tick,
             o_OUT => w_connect_de(i)
           );
         INT2: Edge_Detection
@@ -156,8 +223,25 @@ begin
             o_OUT => w_priority_in(i)
           );
       end generate;
+      DIRECT: if (i > g_int_lines - g_direct_lines) AND (i > 0) generate
+        INT: Synchronizer 
+        port map ( 
+          i_IN => i_INTERRUPT(i),
+          i_CLK => i_CLK,
+          o_OUT => w_connect_sd(i)
+        );
+        w_connect_de(i) <= w_connect_sd(i);
+        INT2: Edge_Detection
+          port map ( 
+            i_IN => w_connect_de(i),
+            i_CLK => i_CLK,
+            o_OUT => w_priority_in(i)
+          );
+      end generate;
     end generate;
     
+    o_INTERRUPT <= w_priority_in(1 to g_int_lines);
+    
     
     PROC_priority: process (w_priority_in)
     begin
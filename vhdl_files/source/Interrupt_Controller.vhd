@@ -0,0 +1,196 @@
+-- BSD 3-Clause License
+-- 
+-- Copyright (c) 2018, Bernhard Vacarescu
+-- All rights reserved.
+-- 
+-- Redistribution and use in source and binary forms, with or without
+-- modification, are permitted provided that the following conditions are met:
+-- 
+-- * Redistributions of source code must retain the above copyright notice, this
+--   list of conditions and the following disclaimer.
+-- 
+-- * Redistributions in binary form must reproduce the above copyright notice,
+--   this list of conditions and the following disclaimer in the documentation
+--   and/or other materials provided with the distribution.
+-- 
+-- * Neither the name of the copyright holder nor the names of its
+--   contributors may be used to endorse or promote products derived from
+--   this software without specific prior written permission.
+-- 
+-- THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+-- AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+-- IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+-- DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+-- FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+-- DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+-- SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+-- CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+-- OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+-- OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------------
+-- INTERRUPT CONTROLLER
+----------------------------------------------------------------------------------
+-- Latches the requests of the interrupt lines (one pulse per rising edge, see 
+-- module "Event_Controller") and selects the event that is loaded into the 
+-- EVENT register of the processor. Every line has an enable bit and a priority
+-- (0 to 7). A pending line is only forwarded if it is enabled and its priority
+-- is higher than the current level (i_LEVEL: bits 7 to 5 of CC). The 
+-- microcode sets the level of an interrupt routine to the priority of its 
+-- line, so a routine can only be interrupted by a line with a higher priority
+-- (if it clears the I flag). The line with the highest priority is forwarded,
+-- of lines with the same priority the lower line. The output is the line 
+-- number + 1 (like the event numbers of the "Event_Controller"), if no line is
+-- forwarded the MSB of the output is 1, the other bits are 0.
+-- Registers (registers 21 to 23 of the processor instead of constants):
+--    ISEL (21):   number of the line (1 to g_int_lines) that ICTRL accesses
+--    ICTRL (22):  bit 7: enable, bit 6: pending, bits 2-0: priority of the 
+--                 selected line (read 0 if ISEL is no line number). Writing 
+--                 the pending bit requests (1) or cancels (0) an interrupt.
+--    IENTRY (23): read only, CC of an interrupt routine: all bits set except
+--                 bits 7 to 5, which are the priority of the served line 
+--                 (i_SERVED: event number, all bits set if it is no line, 
+--                 e.g. SWI)
+-- The pending bit of the served line is cleared if the microcode writes the
+-- EVENT register (i_ACK). A request at the same clock edge is not lost.
+-- o_TAKEN is set during this acknowledge if the served event is a line (an 
+-- interrupt is taken, not for a reset or SWI).
+-- A reset event (i_RESET) enables all lines, sets all priorities to 7 and 
+-- clears all pending bits. Without programming the controller every routine
+-- runs at level 7 (CC = 0xFF) and cannot be interrupted by another line.
+----------------------------------------------------------------------------------
+
+library IEEE;
+use IEEE.STD_LOGIC_1164.ALL;
+use IEEE.NUMERIC_STD.ALL;
+
+
+entity Interrupt_Controller is
+    Generic ( 
+      g_bit : positive; -- bit size of the registers and the output
+      g_int_lines : positive
+    );
+    Port ( 
+      i_CLK : in STD_LOGIC;
+      i_RESET : in STD_LOGIC; -- reset event (pulse)
+      i_INTERRUPT : in STD_LOGIC_VECTOR (1 to g_int_lines); -- pulses
+      i_LEVEL : in STD_LOGIC_VECTOR (2 downto 0); -- CC bits 7 to 5
+      i_WR_SEL : in STD_LOGIC; -- ISEL <- i_DATA
+      i_WR_CTRL : in STD_LOGIC; -- ICTRL <- i_DATA
+      i_DATA : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
+      i_ACK : in STD_LOGIC; -- routine of i_SERVED is entered
+      i_SERVED : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
+      o_SEL : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+      o_CTRL : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+      o_ENTRY_CC : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+      o_TAKEN : out STD_LOGIC; -- i_ACK of a line
+      o_EVENT_CONTROL : out STD_LOGIC_VECTOR (g_bit-1 downto 0) 
+    );
+end Interrupt_Controller;
+
+
+
+architecture Behavioral of Interrupt_Controller is
+
+    type t_PRIORITY is array (1 to g_int_lines) of UNSIGNED (2 downto 0);
+    
+    signal r_SEL : STD_LOGIC_VECTOR (g_bit-1 downto 0) := (others => '0');
+    signal r_ENABLE : STD_LOGIC_VECTOR (1 to g_int_lines) := (others => '1');
+    signal r_PENDING : STD_LOGIC_VECTOR (1 to g_int_lines) := (others => '0');
+    signal r_PRIORITY : t_PRIORITY := (others => "111");
+    
+    -- line selected by ISEL and line of the served event (0: no line)
+    signal w_sel : natural range 0 to g_int_lines;
+    signal w_served : natural range 0 to g_int_lines;
+
+begin
+
+    w_sel <= to_integer(UNSIGNED(r_SEL)) 
+               when (to_integer(UNSIGNED(r_SEL)) >= 1 AND 
+                     to_integer(UNSIGNED(r_SEL)) <= g_int_lines) 
+             else 0;
+    w_served <= to_integer(UNSIGNED(i_SERVED)) - 1 
+                  when (to_integer(UNSIGNED(i_SERVED)) >= 2 AND 
+                        to_integer(UNSIGNED(i_SERVED)) <= g_int_lines + 1) 
+                else 0;
+    
+    
+    PROC_registers: process (i_CLK)
+    begin
+      if rising_edge(i_CLK) then
+        if i_RESET = '1' then
+          r_SEL <= (others => '0');
+          r_ENABLE <= (others => '1');
+          r_PENDING <= (others => '0');
+          r_PRIORITY <= (others => "111");
+        else
+          if i_WR_SEL = '1' then
+            r_SEL <= i_DATA;
+          end if;
+          
+          for i in 1 to g_int_lines loop
+            if i_INTERRUPT(i) = '1' then
+              r_PENDING(i) <= '1';
+            elsif (i_WR_CTRL = '1') AND (w_sel = i) then
+              r_PENDING(i) <= i_DATA(6);
+            elsif (i_ACK = '1') AND (w_served = i) then
+              r_PENDING(i) <= '0';
+            end if;
+            
+            if (i_WR_CTRL = '1') AND (w_sel = i) then
+              r_ENABLE(i) <= i_DATA(7);
+              r_PRIORITY(i) <= UNSIGNED(i_DATA(2 downto 0));
+            end if;
+          end loop;
+        end if;
+      end if;
+    end process PROC_registers;
+    
+    
+    PROC_priority: process (r_PENDING, r_ENABLE, r_PRIORITY, i_LEVEL)
+      variable v_line : natural range 0 to g_int_lines;
+      variable v_priority : UNSIGNED (2 downto 0);
+    begin
+      v_line := 0;
+      v_priority := UNSIGNED(i_LEVEL);
+      
+      -- a line is only selected if its priority is higher than the level and
+      -- the priorities of the lower lines
+      for i in 1 to g_int_lines loop
+        if (r_PENDING(i) = '1') AND (r_ENABLE(i) = '1') AND 
+           (r_PRIORITY(i) > v_priority) then
+          v_line := i;
+          v_priority := r_PRIORITY(i);
+        end if;
+      end loop;
+      
+      -- preload default (only MSB set)
+      o_EVENT_CONTROL <= (others => '0');
+      o_EVENT_CONTROL(g_bit-1) <= '1';
+      
+      if v_line /= 0 then
+        o_EVENT_CONTROL <= STD_LOGIC_VECTOR(to_unsigned(v_line + 1, g_bit));
+      end if;
+    end process PROC_priority;
+    
+    
+    -- read access
+    o_SEL <= r_SEL;
+    
+    PROC_read: process (w_sel, w_served, r_PENDING, r_ENABLE, r_PRIORITY)
+    begin
+      o_CTRL <= (others => '0');
+      if w_sel /= 0 then
+        o_CTRL(7) <= r_ENABLE(w_sel);
+        o_CTRL(6) <= r_PENDING(w_sel);
+        o_CTRL(2 downto 0) <= STD_LOGIC_VECTOR(r_PRIORITY(w_sel));
+      end if;
+      
+      o_ENTRY_CC <= (others => '1');
+      if w_served /= 0 then
+        o_ENTRY_CC(7 downto 5) <= STD_LOGIC_VECTOR(r_PRIORITY(w_served));
+      end if;
+    end process PROC_read;
+    
+    o_TAKEN <= i_ACK when w_served /= 0 else '0';
+
+end Behavioral;
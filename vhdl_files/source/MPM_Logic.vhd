@@ -0,0 +1,3456 @@
+-- BSD 3-Clause License
+-- 
+-- Copyright (c) 2018, Bernhard Vacarescu
+-- All rights reserved.
+-- 
+-- Redistribution and use in source and binary forms, with or without
+-- modification, are permitted provided that the following conditions are met:
+-- 
+-- * Redistributions of source code must retain the above copyright notice, this
+--   list of conditions and the following disclaimer.
+-- 
+-- * Redistributions in binary form must reproduce the above copyright notice,
+--   this list of conditions and the following disclaimer in the documentation
+--   and/or other materials provided with the distribution.
+-- 
+-- * Neither the name of the copyright holder nor the names of its
+--   contributors may be used to endorse or promote products derived from
+--   this software without specific prior written permission.
+-- 
+-- THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+-- AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+-- IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+-- DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+-- FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+-- DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+-- SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+-- CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+-- OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+-- OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+----------------------------------------------------------------------------------
+-- MPM LOGIC
+----------------------------------------------------------------------------------
+-- Microprogram memory as combinational logic: every MIR bit is a two-level
+-- (sum of products) function of the MPC. Unused rows of the ROM file are
+-- treated as "don't cares" (except the trap row 0xFFF).
+-- Generated by the "logic_rom_creator" from the ROM file, do not edit (the
+-- file has to be created again every time the ROM file changes).
+----------------------------------------------------------------------------------
+
+library IEEE;
+use IEEE.STD_LOGIC_1164.ALL;
+
+entity MPM_Logic is
+    Port (
+      i_MPC : in STD_LOGIC_VECTOR (11 downto 0);
+      o_MIR : out STD_LOGIC_VECTOR (39 downto 0)
+    );
+end MPM_Logic;
+
+
+
+architecture Dataflow of MPM_Logic is
+begin
+
+    o_MIR(39) <= (i_MPC(11) and i_MPC(7) and i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(7) and i_MPC(6)
+                  and not i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(9) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(5) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(8) and i_MPC(7)
+                  and i_MPC(5) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(6)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(4)
+                  and i_MPC(2)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(8) and not i_MPC(7)
+                  and i_MPC(6) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(8) and i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(7) and i_MPC(6)
+                  and i_MPC(5) and not i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(6) and i_MPC(3) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(5) and i_MPC(4) and i_MPC(3)
+                  and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(3) and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(5) and i_MPC(4) and i_MPC(3)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(9) and i_MPC(7)
+                  and i_MPC(5) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(5)
+                  and not i_MPC(4) and i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(5)
+                  and i_MPC(4) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0));
+    o_MIR(38) <= (not i_MPC(6) and not i_MPC(5) and i_MPC(4) and i_MPC(3)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(7) and i_MPC(6)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(7) and i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and i_MPC(7) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(5) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(6) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(9) and not i_MPC(8) and i_MPC(7)
+                  and not i_MPC(4) and not i_MPC(3) and not i_MPC(2)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(6) and i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(6) and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and not i_MPC(6) and i_MPC(5) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(7) and not i_MPC(6) and not i_MPC(3)
+                  and not i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(5) and i_MPC(2)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(2) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(6) and i_MPC(5) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(5) and i_MPC(4) and i_MPC(3)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(5) and i_MPC(4) and i_MPC(3)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(8) and i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(5) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(5)
+                  and not i_MPC(3) and i_MPC(2) and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and not i_MPC(5)
+                  and i_MPC(4) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(5)
+                  and not i_MPC(4) and i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0));
+    o_MIR(37) <= (not i_MPC(5) and i_MPC(4) and i_MPC(3) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(5) and i_MPC(3) and i_MPC(2) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(6)
+                  and not i_MPC(4)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(8) and not i_MPC(6)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(8) and not i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(3) and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(7)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(5) and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(6) and i_MPC(2)) or
+                 (not i_MPC(9) and i_MPC(6) and not i_MPC(4) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (not i_MPC(7) and i_MPC(6) and i_MPC(3) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9)
+                  and not i_MPC(8) and i_MPC(5)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(7) and i_MPC(6)
+                  and i_MPC(5) and not i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(5)
+                  and not i_MPC(3) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(8) and not i_MPC(5) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and not i_MPC(6) and i_MPC(3)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(7) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(2)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(7)
+                  and i_MPC(6) and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(6) and i_MPC(4)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(7) and not i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(8) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(4)
+                  and i_MPC(2)) or
+                 (i_MPC(5) and i_MPC(4) and i_MPC(3) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(6) and i_MPC(4) and i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and not i_MPC(4) and i_MPC(3)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and i_MPC(7) and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(7) and i_MPC(4)
+                  and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(4)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(8) and i_MPC(7) and i_MPC(6)
+                  and i_MPC(1)) or
+                 (not i_MPC(9) and i_MPC(8) and i_MPC(6) and i_MPC(4)
+                  and i_MPC(1)) or
+                 (i_MPC(8) and not i_MPC(5) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and not i_MPC(5) and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(7) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(6) and not i_MPC(4)
+                  and i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(6)
+                  and i_MPC(5) and i_MPC(4) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(3) and i_MPC(0)) or
+                 (i_MPC(8) and i_MPC(3) and i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(5) and i_MPC(2)) or
+                 (i_MPC(10) and i_MPC(7) and i_MPC(5) and i_MPC(3)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(6)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(8) and not i_MPC(4)
+                  and not i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(8) and i_MPC(4)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(6) and not i_MPC(4) and i_MPC(2)
+                  and i_MPC(1)) or
+                 (i_MPC(10) and not i_MPC(7) and not i_MPC(5) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(7) and not i_MPC(4) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(3) and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and i_MPC(6) and i_MPC(5) and not i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(7) and i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and not i_MPC(3)
+                  and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and i_MPC(0));
+    o_MIR(36) <= (i_MPC(4) and i_MPC(3) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(4) and i_MPC(3) and i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(5) and i_MPC(3) and i_MPC(2) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(3) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7) and i_MPC(6)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8)) or
+                 (i_MPC(11) and i_MPC(9)) or
+                 (i_MPC(10) and i_MPC(6) and not i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(8) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(6) and not i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and i_MPC(7) and i_MPC(0)) or
+                 (i_MPC(7) and not i_MPC(5) and not i_MPC(4) and i_MPC(3)
+                  and not i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and i_MPC(6) and i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(8) and i_MPC(6) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6) and i_MPC(4)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(3) and i_MPC(2)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(8) and i_MPC(6)
+                  and not i_MPC(5)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(2)
+                  and i_MPC(1)) or
+                 (not i_MPC(7) and i_MPC(6) and not i_MPC(5) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(10) and not i_MPC(7) and not i_MPC(5) and i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(2)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(5)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(5) and not i_MPC(4)
+                  and i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(7)
+                  and i_MPC(6) and not i_MPC(4) and not i_MPC(3)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(8) and not i_MPC(7) and i_MPC(6)
+                  and i_MPC(4) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(3) and i_MPC(1)) or
+                 (i_MPC(9) and not i_MPC(8) and i_MPC(6) and not i_MPC(5)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(7) and i_MPC(4)
+                  and i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(6) and not i_MPC(4) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (not i_MPC(9) and i_MPC(8) and i_MPC(6) and i_MPC(4)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(6) and i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(7) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(5) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(8) and not i_MPC(6) and i_MPC(5) and i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(7) and i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(3) and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(5) and i_MPC(2)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(4) and not i_MPC(2)) or
+                 (i_MPC(9) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(4)) or
+                 (not i_MPC(11) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(3)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(7) and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and i_MPC(7) and i_MPC(6)
+                  and i_MPC(1)) or
+                 (i_MPC(8) and not i_MPC(7) and not i_MPC(4) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(6) and not i_MPC(4) and i_MPC(3) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(4) and i_MPC(2)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and not i_MPC(3)
+                  and i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(4) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(4) and not i_MPC(3) and not i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(6) and not i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(1) and i_MPC(0));
+    o_MIR(35) <= (i_MPC(4) and i_MPC(3) and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7) and i_MPC(6)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(8) and not i_MPC(5)
+                  and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(7) and not i_MPC(6)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and i_MPC(7) and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(3) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(5) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(5) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(3) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(4)
+                  and i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(5) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(7) and i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(6) and not i_MPC(5) and i_MPC(4)
+                  and i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(5) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(4) and not i_MPC(3) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(7) and not i_MPC(6) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(9) and not i_MPC(8) and i_MPC(6)
+                  and i_MPC(5) and i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(7) and not i_MPC(6)
+                  and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(4) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(7) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(8) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(0)) or
+                 (i_MPC(8) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(5) and not i_MPC(4)
+                  and i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(8) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(6) and not i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(5) and i_MPC(3)) or
+                 (i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (i_MPC(5) and not i_MPC(4) and i_MPC(3) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(5) and not i_MPC(4) and i_MPC(3)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(8) and i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(8)
+                  and not i_MPC(5) and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(5)
+                  and i_MPC(4) and i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(2) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(2) and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(5) and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(8)
+                  and not i_MPC(4)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(5) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and i_MPC(8) and not i_MPC(5)
+                  and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and not i_MPC(4) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(3)
+                  and i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(9) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(4) and i_MPC(3)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(5) and i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and not i_MPC(2) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(7) and i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0));
+    o_MIR(34) <= (i_MPC(4) and i_MPC(3) and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8)) or
+                 (i_MPC(11) and i_MPC(9)) or
+                 (i_MPC(11) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(7) and i_MPC(6) and not i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(7) and not i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(8) and i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and i_MPC(6) and not i_MPC(2)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(6) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(9) and not i_MPC(8) and i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(3) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(5) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(4) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(8) and i_MPC(7) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(4)
+                  and not i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(5) and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(7) and not i_MPC(5) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(6) and i_MPC(3) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(5) and not i_MPC(4) and i_MPC(3) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(7) and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and i_MPC(8) and not i_MPC(5)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(4)
+                  and i_MPC(2)) or
+                 (i_MPC(10) and i_MPC(9) and i_MPC(8) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(7) and not i_MPC(3)
+                  and not i_MPC(2)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(6) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(3)
+                  and i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(5) and not i_MPC(4) and i_MPC(3)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and i_MPC(5) and not i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and not i_MPC(5)
+                  and i_MPC(4) and not i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(5) and i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(7) and i_MPC(5)
+                  and i_MPC(4) and i_MPC(2) and not i_MPC(1));
+    o_MIR(33) <= (i_MPC(7) and not i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8)) or
+                 (i_MPC(11) and i_MPC(9)) or
+                 (i_MPC(11) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(8) and not i_MPC(6)) or
+                 (i_MPC(10) and i_MPC(8) and i_MPC(7) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(8) and not i_MPC(3) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(6) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(3) and i_MPC(1)) or
+                 (i_MPC(9) and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(1)) or
+                 (i_MPC(10) and not i_MPC(9) and i_MPC(7) and i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(8) and i_MPC(5) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(5) and i_MPC(4) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (not i_MPC(7) and not i_MPC(6) and i_MPC(5) and i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(5) and i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(8) and i_MPC(5) and i_MPC(4) and not i_MPC(3)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(4) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(7) and i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(5) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(7)
+                  and i_MPC(5) and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and i_MPC(5) and i_MPC(4) and not i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(3) and not i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(5) and i_MPC(4)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(8) and not i_MPC(5)
+                  and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(4) and i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(4)
+                  and not i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(3) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(3) and not i_MPC(2)) or
+                 (i_MPC(9) and not i_MPC(7) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(5) and i_MPC(3) and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(5) and i_MPC(3)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(5) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(3) and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(3) and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(10) and not i_MPC(7) and not i_MPC(6) and i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(6) and not i_MPC(4)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(6)
+                  and not i_MPC(3) and not i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and not i_MPC(3) and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and i_MPC(7) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(5) and i_MPC(3)
+                  and not i_MPC(2)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(7) and not i_MPC(3)
+                  and not i_MPC(2)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8) and i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(7)
+                  and not i_MPC(4) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(5) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and not i_MPC(3)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8) and i_MPC(6)
+                  and i_MPC(4) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(5)
+                  and i_MPC(4) and i_MPC(2) and not i_MPC(1));
+    o_MIR(32) <= (i_MPC(4) and i_MPC(3) and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(7) and not i_MPC(5)
+                  and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(8) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(8) and i_MPC(7)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(3) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(7)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(7) and i_MPC(6)
+                  and not i_MPC(3) and not i_MPC(2)) or
+                 (not i_MPC(8) and not i_MPC(3) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(3) and not i_MPC(2)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(5) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(6) and not i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(4) and i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(7) and not i_MPC(5) and i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6) and i_MPC(3)
+                  and not i_MPC(2)) or
+                 (i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(6) and not i_MPC(5) and i_MPC(4)
+                  and i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(4)
+                  and i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(7) and i_MPC(5) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(8) and i_MPC(7)
+                  and i_MPC(6) and not i_MPC(4)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7) and i_MPC(6)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(5) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(7) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and not i_MPC(6) and i_MPC(1)) or
+                 (i_MPC(5) and i_MPC(3) and i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(5) and i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(8) and i_MPC(5) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and not i_MPC(4) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(6)
+                  and i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(5) and i_MPC(4) and i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and not i_MPC(5) and i_MPC(4)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(8) and i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(6) and not i_MPC(4)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(6) and i_MPC(4) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(9) and not i_MPC(8) and i_MPC(7)
+                  and i_MPC(6) and not i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(4) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(6) and i_MPC(4)
+                  and i_MPC(3)) or
+                 (not i_MPC(11) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(6) and i_MPC(3) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(7) and not i_MPC(5)
+                  and i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(9) and i_MPC(8) and not i_MPC(5)
+                  and i_MPC(0)) or
+                 (not i_MPC(7) and i_MPC(6) and not i_MPC(5) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(5) and not i_MPC(4) and i_MPC(3)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(8) and i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(6)
+                  and i_MPC(5) and not i_MPC(4) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(4) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and not i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(7) and i_MPC(5)
+                  and i_MPC(4) and i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and not i_MPC(3)
+                  and i_MPC(1) and i_MPC(0));
+    o_MIR(31) <= (not i_MPC(5) and i_MPC(4) and i_MPC(3) and not i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(4) and i_MPC(3) and i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(8) and i_MPC(5)
+                  and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and i_MPC(7) and not i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and not i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(6) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(8) and not i_MPC(7) and i_MPC(5) and i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(5) and not i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(5) and not i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(6) and i_MPC(4)
+                  and not i_MPC(3) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(7) and not i_MPC(5) and i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and i_MPC(5) and i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(6) and i_MPC(4) and i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(8) and i_MPC(7) and not i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(6)
+                  and not i_MPC(4) and i_MPC(3) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(8) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(3) and i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(4) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(4)) or
+                 (not i_MPC(11) and i_MPC(5) and i_MPC(3) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(8) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(7)
+                  and not i_MPC(5) and not i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(9) and i_MPC(7) and i_MPC(4) and i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(7) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(8) and i_MPC(7) and i_MPC(6) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(5) and not i_MPC(4) and i_MPC(3)
+                  and not i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(8) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(2) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(6) and not i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(2) and i_MPC(1) and not i_MPC(0));
+    o_MIR(30) <= (i_MPC(9) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(8) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(9) and not i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(8) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(3) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9)
+                  and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(9) and i_MPC(8) and i_MPC(7) and i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(5) and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(6) and i_MPC(3) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(7) and i_MPC(6) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(3) and i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(4)
+                  and i_MPC(2)) or
+                 (i_MPC(9) and not i_MPC(8) and i_MPC(7) and i_MPC(4)
+                  and i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(9) and not i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(8) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(5) and i_MPC(3) and i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(5) and i_MPC(2)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and i_MPC(7) and i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(8) and not i_MPC(7) and i_MPC(5)
+                  and i_MPC(4) and not i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(5) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0));
+    o_MIR(29) <= (not i_MPC(5) and i_MPC(4) and i_MPC(3) and not i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(8) and i_MPC(5)
+                  and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(4)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(7) and not i_MPC(6) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(8) and i_MPC(7)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(8) and i_MPC(7) and not i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(7) and i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(6) and i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(10) and not i_MPC(9) and i_MPC(8) and not i_MPC(4)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(5) and i_MPC(4) and i_MPC(3)
+                  and i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(4)
+                  and not i_MPC(3) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(6) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(1)) or
+                 (i_MPC(9) and i_MPC(8) and i_MPC(7) and i_MPC(5)
+                  and i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(7) and i_MPC(5) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(6) and i_MPC(3) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(4)
+                  and i_MPC(2)) or
+                 (i_MPC(9) and not i_MPC(8) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(1)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(2)) or
+                 (i_MPC(9) and not i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(7) and not i_MPC(5) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(5)
+                  and not i_MPC(3) and i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(5) and i_MPC(3) and i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(7) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(8) and i_MPC(7) and i_MPC(6) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and i_MPC(6) and not i_MPC(4) and not i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and not i_MPC(3)
+                  and i_MPC(2)) or
+                 (not i_MPC(11) and i_MPC(5) and not i_MPC(4) and i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(5) and not i_MPC(4) and i_MPC(3)
+                  and i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(5)
+                  and i_MPC(4) and i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(3) and not i_MPC(2)
+                  and i_MPC(1) and not i_MPC(0));
+    o_MIR(28) <= (not i_MPC(11) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(5) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(5) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(3) and not i_MPC(2)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(6) and i_MPC(5) and i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(9) and not i_MPC(8) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(7) and i_MPC(4) and i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(7) and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(3) and not i_MPC(2)) or
+                 (not i_MPC(7) and i_MPC(5) and not i_MPC(3) and i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(4) and i_MPC(3)) or
+                 (not i_MPC(11) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(8) and not i_MPC(5) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(7) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(9) and i_MPC(7) and i_MPC(4) and i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(3) and not i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(7) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(5) and i_MPC(3) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(8) and i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and not i_MPC(3) and not i_MPC(2)
+                  and i_MPC(1) and not i_MPC(0));
+    o_MIR(27) <= (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(4)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(7) and not i_MPC(6) and not i_MPC(4)
+                  and i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(2) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(6) and not i_MPC(5) and i_MPC(3)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(7) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(9) and not i_MPC(8) and i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(5) and not i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(3) and i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(5) and not i_MPC(3)
+                  and i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(9) and not i_MPC(8) and i_MPC(7)
+                  and not i_MPC(6) and i_MPC(5) and not i_MPC(2)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(7) and i_MPC(5)
+                  and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(7) and i_MPC(6) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(6) and i_MPC(4) and not i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6) and i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(5) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(7) and i_MPC(6)
+                  and i_MPC(4)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(4) and i_MPC(3)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(4) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(6) and i_MPC(5) and not i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(4) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (i_MPC(7) and not i_MPC(6) and i_MPC(5) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(8) and not i_MPC(7) and i_MPC(6)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(6) and i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and i_MPC(4) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(6) and not i_MPC(5) and not i_MPC(2)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(5) and i_MPC(3)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(8) and not i_MPC(4)
+                  and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(7) and not i_MPC(2) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(6) and i_MPC(5) and not i_MPC(4) and i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(3) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(6) and i_MPC(5) and i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(6) and i_MPC(5) and i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(6) and i_MPC(3) and i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(5) and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(5) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(5) and not i_MPC(4)
+                  and i_MPC(3)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(5) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and i_MPC(6) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and not i_MPC(6) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and not i_MPC(4) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(6) and i_MPC(5) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(7) and not i_MPC(5) and not i_MPC(4) and i_MPC(3)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(8) and i_MPC(5) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(8)
+                  and not i_MPC(5) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(3) and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(7) and i_MPC(6)
+                  and i_MPC(4) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(5) and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(4) and not i_MPC(3)
+                  and i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(9) and i_MPC(8) and not i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(6) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(2));
+    o_MIR(26) <= (i_MPC(4) and i_MPC(3) and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8)) or
+                 (i_MPC(11) and i_MPC(9)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(8) and not i_MPC(3) and i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(9) and i_MPC(8) and not i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(8) and not i_MPC(7) and i_MPC(6)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(7) and i_MPC(1)) or
+                 (i_MPC(7) and not i_MPC(6) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(5) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(5) and not i_MPC(4)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(6) and not i_MPC(4) and not i_MPC(3)) or
+                 (i_MPC(9) and i_MPC(5) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(8) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(7) and i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(3) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(6) and not i_MPC(5) and i_MPC(4) and i_MPC(3)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(5) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and not i_MPC(6) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(4)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(4)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(8) and i_MPC(6)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(5) and not i_MPC(2)) or
+                 (i_MPC(6) and i_MPC(3) and i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(8) and not i_MPC(4) and i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(7) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(9) and i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(5) and i_MPC(1)) or
+                 (i_MPC(9) and not i_MPC(5) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(7) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(4)
+                  and i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(5) and not i_MPC(3) and not i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and i_MPC(6) and not i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(5) and i_MPC(4) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and i_MPC(5) and not i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and not i_MPC(5)
+                  and i_MPC(4) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(5)
+                  and i_MPC(4) and i_MPC(2) and not i_MPC(0));
+    o_MIR(25) <= (not i_MPC(7) and not i_MPC(6) and i_MPC(5)) or
+                 (i_MPC(11) and i_MPC(8)) or
+                 (i_MPC(11) and i_MPC(9)) or
+                 (i_MPC(10) and not i_MPC(9) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(4)) or
+                 (not i_MPC(8) and i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(8)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(5) and not i_MPC(1)) or
+                 (i_MPC(5) and i_MPC(4) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(8) and not i_MPC(7)
+                  and i_MPC(6) and not i_MPC(4)) or
+                 (not i_MPC(7) and not i_MPC(6) and not i_MPC(3)
+                  and i_MPC(2)) or
+                 (not i_MPC(8) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(8) and i_MPC(5) and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(3) and not i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(10) and not i_MPC(5) and i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(8) and i_MPC(7)
+                  and not i_MPC(3) and not i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(5) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(8) and not i_MPC(4) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(9) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4)) or
+                 (not i_MPC(11) and not i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(5) and not i_MPC(4) and i_MPC(2)) or
+                 (not i_MPC(10) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(9) and i_MPC(5) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(7) and not i_MPC(3)
+                  and not i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(6) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(9) and i_MPC(8) and not i_MPC(3)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)) or
+                 (i_MPC(9) and not i_MPC(7) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(8) and i_MPC(4) and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(8) and i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4)) or
+                 (i_MPC(9) and i_MPC(8) and i_MPC(5) and not i_MPC(2)
+                  and i_MPC(1)) or
+                 (not i_MPC(8) and not i_MPC(4) and i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(8) and i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0));
+    o_MIR(24) <= (i_MPC(11) and i_MPC(8)) or
+                 (i_MPC(11) and i_MPC(9)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(7)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and i_MPC(5) and not i_MPC(3)) or
+                 (i_MPC(10) and i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and i_MPC(6) and i_MPC(4)) or
+                 (i_MPC(11) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(4) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(8) and i_MPC(7)) or
+                 (not i_MPC(11) and i_MPC(5) and not i_MPC(4) and i_MPC(3)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(5) and i_MPC(3) and i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(5) and not i_MPC(3) and not i_MPC(1)) or
+                 (i_MPC(10) and not i_MPC(7) and i_MPC(6) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(3) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(4) and not i_MPC(3) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and not i_MPC(6) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(4) and i_MPC(3) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(7) and i_MPC(4) and i_MPC(3) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(6) and i_MPC(5) and not i_MPC(4) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(4) and not i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(5) and i_MPC(3) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(6) and not i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(4) and not i_MPC(3) and i_MPC(2) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(6)
+                  and not i_MPC(5) and i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(3) and not i_MPC(0)) or
+                 (not i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(4) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(5) and not i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(5) and i_MPC(4) and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(4) and i_MPC(3) and not i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(6)
+                  and i_MPC(5) and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(3) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(8) and not i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(8) and i_MPC(5) and i_MPC(4)) or
+                 (not i_MPC(9) and i_MPC(8) and i_MPC(6) and i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(5) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and not i_MPC(4) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(7) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(5) and i_MPC(4) and i_MPC(3)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and i_MPC(5) and not i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(6) and not i_MPC(4) and not i_MPC(3)
+                  and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and i_MPC(4) and not i_MPC(3) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and not i_MPC(3) and not i_MPC(2)) or
+                 (i_MPC(10) and not i_MPC(9) and i_MPC(8) and i_MPC(6)
+                  and not i_MPC(4) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and not i_MPC(2)
+                  and i_MPC(1));
+    o_MIR(23) <= (i_MPC(8) and not i_MPC(7) and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(9) and i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(9) and i_MPC(8) and not i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(8) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(5) and i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(2)) or
+                 (not i_MPC(10) and i_MPC(7) and i_MPC(6) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(9) and i_MPC(8) and i_MPC(7)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(5) and not i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2)) or
+                 (not i_MPC(4) and i_MPC(3) and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(6)
+                  and i_MPC(4) and not i_MPC(3) and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(2)) or
+                 (not i_MPC(9) and i_MPC(8) and not i_MPC(5) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and i_MPC(7)) or
+                 (i_MPC(11) and i_MPC(2) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and i_MPC(5) and i_MPC(4) and not i_MPC(3)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(7) and not i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(5) and i_MPC(3) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and i_MPC(5) and not i_MPC(1)) or
+                 (not i_MPC(8) and not i_MPC(6) and not i_MPC(5)
+                  and i_MPC(3) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(6) and not i_MPC(5) and i_MPC(4)
+                  and i_MPC(1)) or
+                 (i_MPC(7) and i_MPC(4) and i_MPC(3) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(4) and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(7) and i_MPC(6) and i_MPC(5)
+                  and not i_MPC(3) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(8) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and not i_MPC(3) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(7)
+                  and not i_MPC(6) and i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(4) and i_MPC(3) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(7)
+                  and i_MPC(6) and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(7) and i_MPC(6) and i_MPC(4)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(7) and i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(6)
+                  and i_MPC(4) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(2) and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(3)) or
+                 (i_MPC(10) and i_MPC(8) and i_MPC(6) and not i_MPC(4)
+                  and i_MPC(1)) or
+                 (not i_MPC(7) and i_MPC(6) and not i_MPC(5) and i_MPC(3)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(5)
+                  and not i_MPC(4) and i_MPC(3) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(1)) or
+                 (i_MPC(3) and i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9)
+                  and not i_MPC(4)) or
+                 (i_MPC(9) and not i_MPC(6) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(8) and i_MPC(4)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6) and i_MPC(2)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(7)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and i_MPC(2)) or
+                 (not i_MPC(10) and not i_MPC(7) and i_MPC(6) and i_MPC(4)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and i_MPC(4) and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and not i_MPC(5)
+                  and i_MPC(4) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(7) and i_MPC(6)
+                  and i_MPC(4) and not i_MPC(3) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(5) and not i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0));
+    o_MIR(22) <= (i_MPC(4) and i_MPC(3) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(7) and not i_MPC(5) and i_MPC(1)) or
+                 (i_MPC(8) and not i_MPC(7) and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7) and i_MPC(6)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(9)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(8) and i_MPC(7) and not i_MPC(3) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and not i_MPC(4) and not i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(4) and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(7) and i_MPC(6) and not i_MPC(2)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(6) and not i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(8) and i_MPC(5) and not i_MPC(2)) or
+                 (i_MPC(10) and not i_MPC(7) and not i_MPC(5) and i_MPC(2)) or
+                 (not i_MPC(9) and i_MPC(8) and i_MPC(7) and not i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(6) and i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(6) and i_MPC(5) and i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and i_MPC(7) and not i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(6) and i_MPC(4)
+                  and not i_MPC(3) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(7) and i_MPC(5) and not i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(8) and i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7) and i_MPC(4)) or
+                 (not i_MPC(6) and not i_MPC(4) and i_MPC(3) and i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(7) and i_MPC(6) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(4) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(5) and i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(6) and i_MPC(5) and i_MPC(1)) or
+                 (i_MPC(8) and not i_MPC(4) and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(6) and not i_MPC(5) and i_MPC(3) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(6) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(5)
+                  and i_MPC(2)) or
+                 (not i_MPC(10) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(3) and i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(8) and i_MPC(7) and not i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(4) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(9) and i_MPC(6) and i_MPC(4) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(7) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(3) and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and not i_MPC(3)
+                  and i_MPC(1)) or
+                 (i_MPC(8) and i_MPC(5) and i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(5) and not i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(5) and not i_MPC(4) and i_MPC(3) and i_MPC(2)) or
+                 (i_MPC(3) and i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(7) and i_MPC(0)) or
+                 (not i_MPC(9) and i_MPC(4) and i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(5) and i_MPC(4) and i_MPC(3) and not i_MPC(2)
+                  and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(5)
+                  and i_MPC(4) and not i_MPC(2)) or
+                 (i_MPC(10) and not i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(5) and i_MPC(4) and not i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(4) and i_MPC(0));
+    o_MIR(21) <= (i_MPC(11) and not i_MPC(7) and not i_MPC(5) and i_MPC(2)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(7)) or
+                 (i_MPC(10) and i_MPC(3)) or
+                 (i_MPC(11) and i_MPC(7) and not i_MPC(4) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(6)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(7) and not i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and not i_MPC(5)
+                  and i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(8) and not i_MPC(6)) or
+                 (not i_MPC(7) and not i_MPC(6) and not i_MPC(4)
+                  and i_MPC(3)) or
+                 (i_MPC(11) and i_MPC(7) and not i_MPC(4) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(6) and not i_MPC(5) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and not i_MPC(5)) or
+                 (i_MPC(7) and i_MPC(6) and i_MPC(4) and not i_MPC(2)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(7) and i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7) and i_MPC(5)
+                  and i_MPC(1)) or
+                 (i_MPC(10) and not i_MPC(7) and not i_MPC(6) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(8) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(6) and i_MPC(5) and i_MPC(3)) or
+                 (i_MPC(10) and i_MPC(8) and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(4)
+                  and i_MPC(2)) or
+                 (i_MPC(7) and i_MPC(6) and i_MPC(5) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(7)
+                  and not i_MPC(4) and not i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and i_MPC(2)) or
+                 (i_MPC(7) and not i_MPC(6) and i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(6)
+                  and i_MPC(5) and i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(6) and not i_MPC(2)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9)
+                  and not i_MPC(8) and i_MPC(6) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(3) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(8) and i_MPC(5) and i_MPC(2)) or
+                 (i_MPC(9) and not i_MPC(6) and i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(7) and not i_MPC(5)
+                  and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(7) and not i_MPC(6) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(6)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(6) and not i_MPC(4) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(6) and i_MPC(3) and not i_MPC(2)) or
+                 (i_MPC(8) and i_MPC(5) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(7) and i_MPC(6) and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(8)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(4)) or
+                 (not i_MPC(11) and i_MPC(7) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(4)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7) and i_MPC(6)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and i_MPC(1));
+    o_MIR(20) <= (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(6) and i_MPC(5)) or
+                 (i_MPC(5) and i_MPC(4) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(9) and not i_MPC(8) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(7)) or
+                 (not i_MPC(7) and not i_MPC(6) and not i_MPC(5)
+                  and i_MPC(1)) or
+                 (i_MPC(8) and i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(8) and i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(6)) or
+                 (i_MPC(10) and not i_MPC(6) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(5) and i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(8) and i_MPC(6) and not i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(7) and not i_MPC(5)
+                  and i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and not i_MPC(5)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(7)
+                  and not i_MPC(6) and i_MPC(4) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(7)
+                  and i_MPC(6) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(5) and i_MPC(2)) or
+                 (not i_MPC(11) and i_MPC(5) and not i_MPC(4) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(2)) or
+                 (i_MPC(6) and i_MPC(3) and not i_MPC(2)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(4)
+                  and i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(6) and i_MPC(4)) or
+                 (i_MPC(8) and i_MPC(5) and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6)
+                  and not i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and i_MPC(2)) or
+                 (not i_MPC(10) and i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(7)
+                  and not i_MPC(4) and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(6) and not i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(2)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(4)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8) and i_MPC(5)
+                  and i_MPC(4)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(6) and not i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(8) and i_MPC(5) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(5) and i_MPC(2)) or
+                 (i_MPC(9) and not i_MPC(5) and i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(8) and not i_MPC(6) and not i_MPC(5)
+                  and i_MPC(3)) or
+                 (not i_MPC(6) and i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(7) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(4)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6) and i_MPC(2)
+                  and not i_MPC(1));
+    o_MIR(19) <= (i_MPC(10) and i_MPC(8) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(4)
+                  and not i_MPC(3)) or
+                 (i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(7) and not i_MPC(2)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(3)) or
+                 (not i_MPC(6) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(4)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(8) and i_MPC(5)) or
+                 (not i_MPC(11) and not i_MPC(7) and i_MPC(5)
+                  and not i_MPC(4)) or
+                 (not i_MPC(7) and not i_MPC(5) and i_MPC(3)) or
+                 (i_MPC(10) and not i_MPC(9) and not i_MPC(8) and i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(1)) or
+                 (not i_MPC(8) and not i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and not i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(8)) or
+                 (i_MPC(11) and i_MPC(2) and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(5) and not i_MPC(1)) or
+                 (i_MPC(10) and not i_MPC(9) and not i_MPC(8) and i_MPC(7)
+                  and not i_MPC(6) and i_MPC(4)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(7)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and not i_MPC(4) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(8) and i_MPC(5) and not i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(7) and not i_MPC(5) and not i_MPC(2)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(9) and not i_MPC(8) and i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(8) and i_MPC(6)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(8) and i_MPC(5)
+                  and not i_MPC(3) and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(6) and i_MPC(3)) or
+                 (i_MPC(9) and i_MPC(4) and not i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(6) and not i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(6) and i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(2)
+                  and i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(6) and i_MPC(5) and i_MPC(2)
+                  and i_MPC(1)) or
+                 (not i_MPC(7) and i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(8) and i_MPC(5) and not i_MPC(1)) or
+                 (i_MPC(9) and not i_MPC(8) and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(6) and not i_MPC(4) and i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7) and i_MPC(6)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(2) and i_MPC(1));
+    o_MIR(18) <= (i_MPC(11) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(8) and not i_MPC(7)) or
+                 (i_MPC(6) and not i_MPC(5) and not i_MPC(1)) or
+                 (i_MPC(9) and not i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(8) and i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(3)) or
+                 (i_MPC(7) and not i_MPC(6) and not i_MPC(3)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(9) and not i_MPC(7) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(3)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and i_MPC(6)) or
+                 (not i_MPC(10) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(9) and i_MPC(8) and i_MPC(1)) or
+                 (i_MPC(9) and i_MPC(7) and i_MPC(5)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and not i_MPC(6)) or
+                 (not i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(9) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(7) and not i_MPC(4) and i_MPC(3)) or
+                 (not i_MPC(11) and i_MPC(6) and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and not i_MPC(5)
+                  and i_MPC(4) and not i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(9) and i_MPC(7) and i_MPC(4)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and not i_MPC(5) and not i_MPC(4)) or
+                 (i_MPC(11) and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(6) and not i_MPC(5) and i_MPC(4)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7) and i_MPC(5)
+                  and not i_MPC(2)) or
+                 (i_MPC(8) and i_MPC(5) and i_MPC(2)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and not i_MPC(7)
+                  and i_MPC(6)) or
+                 (i_MPC(11) and i_MPC(6) and not i_MPC(4) and i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(3) and not i_MPC(2)
+                  and i_MPC(0)) or
+                 (not i_MPC(7) and not i_MPC(5) and i_MPC(3)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(6) and not i_MPC(5)) or
+                 (not i_MPC(8) and i_MPC(3) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(5)
+                  and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and i_MPC(5)
+                  and i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1));
+    o_MIR(17) <= (i_MPC(11) and not i_MPC(7) and not i_MPC(5) and i_MPC(2)) or
+                 (i_MPC(10) and not i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(7)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(7) and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(8)
+                  and i_MPC(7)) or
+                 (i_MPC(10) and i_MPC(3)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(6)) or
+                 (i_MPC(10) and not i_MPC(6) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(7) and not i_MPC(6) and not i_MPC(5)
+                  and i_MPC(3)) or
+                 (not i_MPC(10) and i_MPC(7) and i_MPC(6) and not i_MPC(2)
+                  and i_MPC(1)) or
+                 (i_MPC(7) and not i_MPC(6) and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and not i_MPC(5)) or
+                 (not i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(4)
+                  and i_MPC(2)) or
+                 (not i_MPC(10) and i_MPC(8) and i_MPC(5) and i_MPC(2)) or
+                 (not i_MPC(11) and i_MPC(8) and i_MPC(5) and not i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(5) and i_MPC(4) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(6) and not i_MPC(5) and i_MPC(4) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(6) and i_MPC(5) and i_MPC(3)) or
+                 (i_MPC(10) and i_MPC(7) and i_MPC(5) and i_MPC(2)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(7)
+                  and not i_MPC(4) and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(7) and i_MPC(4)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(4) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(5) and not i_MPC(2)
+                  and i_MPC(1)) or
+                 (not i_MPC(7) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and i_MPC(5)
+                  and i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(9) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(8) and i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and not i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(10) and not i_MPC(7) and not i_MPC(6) and i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(8) and i_MPC(3) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(2) and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(1)) or
+                 (i_MPC(6) and not i_MPC(4) and i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(4)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8) and i_MPC(5)
+                  and i_MPC(4)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and not i_MPC(4)
+                  and not i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0));
+    o_MIR(16) <= (i_MPC(11) and i_MPC(10) and not i_MPC(3) and not i_MPC(2)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(9) and i_MPC(8) and not i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(7) and i_MPC(6)
+                  and not i_MPC(2)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(8) and not i_MPC(6)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and i_MPC(7) and not i_MPC(5)) or
+                 (i_MPC(11) and not i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(4) and i_MPC(3)) or
+                 (i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(7) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(5) and i_MPC(4) and not i_MPC(2)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(7) and i_MPC(6) and not i_MPC(4)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and i_MPC(5) and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(9) and not i_MPC(8) and i_MPC(6)
+                  and i_MPC(5) and not i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(5)
+                  and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(7) and not i_MPC(6) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(5) and not i_MPC(4)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(2)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(3) and i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(7) and i_MPC(6) and not i_MPC(5) and i_MPC(4)
+                  and i_MPC(3) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and i_MPC(5) and not i_MPC(4) and not i_MPC(2)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(5) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(3) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(3) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(6) and i_MPC(3)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(6) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(5) and not i_MPC(2)
+                  and i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(6) and i_MPC(5) and i_MPC(2)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(8)
+                  and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and not i_MPC(4) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(6) and i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(7) and not i_MPC(6) and i_MPC(5) and i_MPC(3)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(8)
+                  and i_MPC(7) and i_MPC(5)) or
+                 (not i_MPC(11) and i_MPC(8) and not i_MPC(7) and i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(3) and i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(7) and not i_MPC(5) and i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(6) and not i_MPC(5) and not i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(9) and not i_MPC(8) and i_MPC(6)
+                  and i_MPC(4) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(5) and i_MPC(3)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(6) and not i_MPC(5) and i_MPC(3) and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(7) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(6)
+                  and not i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(4)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(2)
+                  and i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(5) and i_MPC(2) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(6) and i_MPC(4) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and i_MPC(6) and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(4) and i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(3) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8) and i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(7) and i_MPC(6)
+                  and i_MPC(4) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(5)
+                  and i_MPC(3) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(4) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0));
+    o_MIR(15) <= (i_MPC(11) and i_MPC(8) and i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(3) and i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(7) and i_MPC(6) and not i_MPC(2)) or
+                 (not i_MPC(9) and i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(8)
+                  and i_MPC(7)) or
+                 (not i_MPC(9) and not i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(3) and not i_MPC(2)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and not i_MPC(5)) or
+                 (not i_MPC(10) and i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(6) and i_MPC(3) and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(5) and i_MPC(4)) or
+                 (not i_MPC(9) and i_MPC(8) and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(8) and i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(6) and not i_MPC(5) and i_MPC(4)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6) and i_MPC(3)
+                  and not i_MPC(2)) or
+                 (not i_MPC(11) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(5) and not i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(6) and i_MPC(4) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(7) and i_MPC(5)
+                  and i_MPC(2)) or
+                 (not i_MPC(10) and i_MPC(5) and i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(10) and not i_MPC(9) and i_MPC(7) and i_MPC(5)
+                  and not i_MPC(3) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and i_MPC(6) and not i_MPC(3)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(7)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9)
+                  and not i_MPC(8) and i_MPC(6) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(3) and not i_MPC(2)) or
+                 (not i_MPC(8) and not i_MPC(7) and not i_MPC(5)
+                  and i_MPC(4) and not i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(4) and i_MPC(3)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(5) and not i_MPC(4) and i_MPC(3) and i_MPC(1)) or
+                 (i_MPC(5) and i_MPC(4) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(8) and i_MPC(7) and not i_MPC(4)
+                  and not i_MPC(3) and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(4) and not i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(6) and i_MPC(4) and not i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(7) and not i_MPC(6) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(7) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(5)
+                  and i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and i_MPC(8) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(3) and i_MPC(2)) or
+                 (not i_MPC(9) and not i_MPC(8) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(0));
+    o_MIR(14) <= (i_MPC(9) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(4)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(8) and i_MPC(7) and not i_MPC(6)
+                  and i_MPC(4)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(6) and not i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(3) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(7) and i_MPC(6) and not i_MPC(3)
+                  and not i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2)) or
+                 (i_MPC(8) and i_MPC(5) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(5)
+                  and i_MPC(3) and not i_MPC(1)) or
+                 (not i_MPC(9) and not i_MPC(8) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(3) and not i_MPC(2)) or
+                 (not i_MPC(10) and i_MPC(5) and not i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(8) and i_MPC(5) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and i_MPC(5) and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(8) and i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(3)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(7) and not i_MPC(6) and not i_MPC(3)
+                  and not i_MPC(2)) or
+                 (i_MPC(10) and not i_MPC(7) and not i_MPC(6) and i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(7) and i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(3) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(4) and not i_MPC(3) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(4) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and i_MPC(7)) or
+                 (not i_MPC(7) and i_MPC(4) and i_MPC(2) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(6)
+                  and not i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(7)
+                  and i_MPC(5) and not i_MPC(4) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(3) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(8) and i_MPC(7)
+                  and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(3) and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and i_MPC(5) and i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(4) and i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(8) and i_MPC(6) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(6) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(9) and not i_MPC(8) and i_MPC(7)
+                  and i_MPC(5) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(4) and i_MPC(3) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(5)
+                  and i_MPC(4) and i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(3) and i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(4) and i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(6) and i_MPC(3)) or
+                 (not i_MPC(10) and i_MPC(9) and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(4) and i_MPC(3) and i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(8) and i_MPC(5)
+                  and i_MPC(4)) or
+                 (i_MPC(10) and i_MPC(7) and i_MPC(5) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(3) and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(7) and i_MPC(6) and i_MPC(4)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(2) and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(7) and i_MPC(4)
+                  and not i_MPC(3) and not i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(3) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(4)
+                  and not i_MPC(3) and i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0));
+    o_MIR(13) <= (i_MPC(9) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(7) and not i_MPC(5) and i_MPC(4)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8)) or
+                 (i_MPC(11) and i_MPC(9)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and i_MPC(5)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(9) and i_MPC(8) and not i_MPC(5)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(3) and i_MPC(1)) or
+                 (i_MPC(8) and i_MPC(7) and not i_MPC(5) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(5) and not i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(5) and i_MPC(4) and i_MPC(3)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(4) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(3) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(8) and i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(2) and not i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(9) and i_MPC(8) and not i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(8) and i_MPC(7) and i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(8) and not i_MPC(6) and not i_MPC(5) and i_MPC(4)) or
+                 (not i_MPC(10) and i_MPC(6) and i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(7) and not i_MPC(3)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(4) and i_MPC(3)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(3) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(0)) or
+                 (not i_MPC(7) and not i_MPC(6) and i_MPC(5) and i_MPC(3)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(7) and i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and not i_MPC(3) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(7) and i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(6) and not i_MPC(4) and not i_MPC(3)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(4) and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(8) and i_MPC(7) and i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(8) and i_MPC(6) and not i_MPC(4)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(6) and not i_MPC(5) and i_MPC(4)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(4) and not i_MPC(3) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(10) and not i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(8) and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(2) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(7) and i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(4)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(7) and i_MPC(6) and i_MPC(4)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(0));
+    o_MIR(12) <= (i_MPC(11) and i_MPC(8)) or
+                 (i_MPC(11) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and i_MPC(6)) or
+                 (i_MPC(9) and i_MPC(7) and i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(1)) or
+                 (not i_MPC(9) and not i_MPC(7) and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(8) and i_MPC(7) and i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(3)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(1)) or
+                 (i_MPC(9) and not i_MPC(6) and not i_MPC(0)) or
+                 (not i_MPC(9) and not i_MPC(7) and i_MPC(4) and i_MPC(3)
+                  and not i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(3) and i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(7) and i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(8) and i_MPC(7) and not i_MPC(5) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(3) and i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(8) and i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(4)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(5) and not i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(7) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6) and i_MPC(4)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(5) and i_MPC(3)
+                  and not i_MPC(2)) or
+                 (not i_MPC(7) and not i_MPC(6) and i_MPC(5) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(7) and i_MPC(6) and not i_MPC(4) and not i_MPC(3)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(3) and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(7) and not i_MPC(6) and not i_MPC(3)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(5) and i_MPC(2)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(9) and i_MPC(8) and not i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(4) and i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and i_MPC(3) and not i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(5) and i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(9) and i_MPC(8) and i_MPC(6) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(5)
+                  and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(5) and i_MPC(3)
+                  and not i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(3) and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(7) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(9) and i_MPC(8) and i_MPC(3)) or
+                 (not i_MPC(5) and i_MPC(3) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(5) and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(9) and i_MPC(6) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(8) and i_MPC(7) and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(6) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(5)
+                  and not i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(4) and not i_MPC(3)
+                  and i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(3) and i_MPC(2));
+    o_MIR(11) <= (not i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(8) and not i_MPC(7)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(8) and not i_MPC(6)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(9) and not i_MPC(7)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(9) and not i_MPC(6)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and not i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(3) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(3)) or
+                 (i_MPC(11) and i_MPC(6) and not i_MPC(4) and i_MPC(3)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(3)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and not i_MPC(5)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(7) and not i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(4)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(5) and i_MPC(2)
+                  and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(3) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and not i_MPC(4) and i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and i_MPC(6) and i_MPC(3)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(8) and i_MPC(4)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(4)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and i_MPC(0));
+    o_MIR(10) <= (i_MPC(11) and i_MPC(10) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(6) and i_MPC(5) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(8) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(9) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(3) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(3)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(3)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and not i_MPC(5)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(4)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and i_MPC(6) and i_MPC(3)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(5) and i_MPC(2)
+                  and i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(9) and i_MPC(8) and i_MPC(2)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(9) and i_MPC(8)
+                  and i_MPC(5) and not i_MPC(3) and not i_MPC(2)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(9) and not i_MPC(8) and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(4)
+                  and i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and i_MPC(0));
+    o_MIR(9) <= (not i_MPC(11) and i_MPC(9) and not i_MPC(8) and i_MPC(7)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and i_MPC(8) and i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9)
+                  and not i_MPC(8) and i_MPC(5) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(9) and i_MPC(8)
+                  and i_MPC(5) and not i_MPC(3) and not i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(3)) or
+                 (i_MPC(9) and not i_MPC(8) and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(8) and i_MPC(6)
+                  and i_MPC(4) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0));
+    o_MIR(8) <= (i_MPC(10) and i_MPC(9) and i_MPC(8) and i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(9) and i_MPC(8)
+                  and i_MPC(5) and not i_MPC(3) and not i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(3)) or
+                 (not i_MPC(9) and i_MPC(8) and i_MPC(3) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(8) and not i_MPC(5) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(8) and i_MPC(7) and i_MPC(6) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0));
+    o_MIR(7) <= (not i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(8) and i_MPC(7)
+                  and not i_MPC(6) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(7)
+                  and not i_MPC(6) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(7) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(7) and i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(3)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(6) and i_MPC(3)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and i_MPC(7) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(5)
+                  and i_MPC(3)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(7) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(3)) or
+                 (i_MPC(10) and i_MPC(9) and i_MPC(8) and i_MPC(2)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(7)
+                  and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and not i_MPC(4) and i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(9) and i_MPC(8)
+                  and i_MPC(5) and not i_MPC(3) and not i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(4) and i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and not i_MPC(8)
+                  and i_MPC(7) and not i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(9) and i_MPC(8) and i_MPC(3) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(8) and not i_MPC(5) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(8) and i_MPC(7)
+                  and i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(8) and i_MPC(7) and i_MPC(6) and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(5)
+                  and i_MPC(4) and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and i_MPC(0));
+    o_MIR(6) <= (not i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(6) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(8) and not i_MPC(5)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(6) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(8) and i_MPC(7)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(6)) or
+                 (i_MPC(11) and i_MPC(9) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(8) and i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(8) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(7) and i_MPC(6) and i_MPC(3)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(7) and i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(8) and i_MPC(7)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(3) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(3)
+                  and not i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and not i_MPC(4)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(8) and i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(7)
+                  and not i_MPC(4)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(3)) or
+                 (i_MPC(10) and i_MPC(9) and i_MPC(8) and not i_MPC(3)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(10) and not i_MPC(8) and not i_MPC(7) and i_MPC(6)
+                  and i_MPC(4) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(7) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(9) and not i_MPC(5)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(6) and not i_MPC(4) and i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(7) and i_MPC(6) and not i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and i_MPC(6) and not i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(5) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(8) and i_MPC(6)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and i_MPC(8) and i_MPC(2)
+                  and not i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(6) and not i_MPC(5) and not i_MPC(4) and i_MPC(3)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(8) and not i_MPC(4)
+                  and not i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(8) and i_MPC(7)
+                  and i_MPC(5) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0));
+    o_MIR(5) <= (not i_MPC(11) and i_MPC(9) and not i_MPC(7)
+                  and not i_MPC(4)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(6) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(5) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(9) and i_MPC(8) and i_MPC(5)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(5) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(9) and i_MPC(8) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9)
+                  and not i_MPC(8) and i_MPC(5)) or
+                 (i_MPC(11) and i_MPC(5) and i_MPC(3) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(5)
+                  and i_MPC(3)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(8) and not i_MPC(7)
+                  and i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(7) and i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9)
+                  and not i_MPC(8) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(3)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(7) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(8) and not i_MPC(6)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(5) and i_MPC(4) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(9) and i_MPC(8)
+                  and i_MPC(5) and not i_MPC(3) and not i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5) and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(7) and i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(7) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(5) and not i_MPC(4)
+                  and i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(9) and not i_MPC(7) and i_MPC(5) and not i_MPC(2)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(7) and not i_MPC(5) and not i_MPC(3)
+                  and i_MPC(2) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(1) and not i_MPC(0));
+    o_MIR(4) <= (i_MPC(5) and i_MPC(3) and i_MPC(2) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(9) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(4) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(9) and not i_MPC(7) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(9) and i_MPC(8) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(4)
+                  and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9)
+                  and not i_MPC(8) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(4) and i_MPC(3) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and i_MPC(4)) or
+                 (i_MPC(7) and not i_MPC(6) and i_MPC(4) and i_MPC(3)) or
+                 (i_MPC(10) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(3)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(7)
+                  and not i_MPC(5) and i_MPC(4) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(8) and i_MPC(5)
+                  and i_MPC(4)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(7)
+                  and not i_MPC(5) and not i_MPC(4)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(6) and i_MPC(4) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(7)
+                  and i_MPC(6) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and i_MPC(8) and i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(7) and i_MPC(6) and i_MPC(4) and i_MPC(3)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and not i_MPC(6) and i_MPC(4)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(5) and i_MPC(4) and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(7) and i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(7) and not i_MPC(5) and i_MPC(4)
+                  and not i_MPC(3) and i_MPC(2) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(6) and not i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(3) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and i_MPC(7) and i_MPC(4)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(7) and i_MPC(6)
+                  and i_MPC(5) and i_MPC(4)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(8) and i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(9) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(6) and i_MPC(5) and i_MPC(4)) or
+                 (i_MPC(11) and not i_MPC(9) and i_MPC(8) and i_MPC(7)
+                  and i_MPC(6) and not i_MPC(5) and i_MPC(4)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and not i_MPC(7)
+                  and not i_MPC(5) and not i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and i_MPC(5) and i_MPC(4) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0));
+    o_MIR(3) <= (not i_MPC(11) and i_MPC(9) and not i_MPC(7)
+                  and not i_MPC(6) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(6)
+                  and i_MPC(5) and i_MPC(4) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and i_MPC(7) and not i_MPC(6)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(3) and i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(8) and i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(6)
+                  and not i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(5) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and i_MPC(7) and i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(3) and not i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(4) and i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(4) and i_MPC(3)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(6) and i_MPC(5) and i_MPC(3)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(8) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(4) and not i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(7)
+                  and i_MPC(6) and not i_MPC(5) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(6) and not i_MPC(4) and i_MPC(3) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(8) and i_MPC(5)
+                  and i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(5) and i_MPC(4) and i_MPC(3)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and not i_MPC(3)
+                  and i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(8) and i_MPC(7)
+                  and i_MPC(6) and not i_MPC(5) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(9) and not i_MPC(5)
+                  and not i_MPC(3) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(3) and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9) and i_MPC(7)
+                  and i_MPC(6) and not i_MPC(5) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0));
+    o_MIR(2) <= (i_MPC(5) and i_MPC(3) and i_MPC(2) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and not i_MPC(4) and i_MPC(3)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(3)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(3)) or
+                 (not i_MPC(11) and i_MPC(4) and i_MPC(3) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(7) and i_MPC(6) and not i_MPC(5) and i_MPC(3)
+                  and not i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(7) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(5) and i_MPC(2)
+                  and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(6) and not i_MPC(4) and i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(5) and i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(7) and i_MPC(6) and not i_MPC(3)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(3) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(8) and i_MPC(7)
+                  and i_MPC(5) and i_MPC(4) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(8) and not i_MPC(4) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(9) and not i_MPC(6) and i_MPC(2) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(6) and not i_MPC(5) and not i_MPC(4) and i_MPC(3)
+                  and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(8) and not i_MPC(4)
+                  and not i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(4) and i_MPC(2)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(6) and i_MPC(3) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(9) and i_MPC(8) and i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(3) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and i_MPC(2)
+                  and not i_MPC(0));
+    o_MIR(1) <= (i_MPC(5) and i_MPC(3) and i_MPC(2) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and not i_MPC(4) and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(3)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(8)
+                  and i_MPC(7) and not i_MPC(2) and not i_MPC(1)
+                  and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(3)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(7) and not i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(8) and i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and not i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(6) and not i_MPC(5)
+                  and i_MPC(3)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(5)
+                  and not i_MPC(3) and i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(9) and i_MPC(8)
+                  and i_MPC(5) and not i_MPC(3) and not i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(5) and i_MPC(2) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and i_MPC(6) and i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(6) and not i_MPC(4) and i_MPC(3) and i_MPC(2)
+                  and not i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(9) and i_MPC(8) and i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(8) and i_MPC(7) and i_MPC(6) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(8) and i_MPC(6)
+                  and i_MPC(4) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(2) and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and i_MPC(2)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(5) and not i_MPC(4)
+                  and not i_MPC(3) and i_MPC(1) and not i_MPC(0));
+    o_MIR(0) <= (i_MPC(5) and i_MPC(3) and i_MPC(2) and i_MPC(1)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(5)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(7) and i_MPC(6)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(8) and not i_MPC(6)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(9) and not i_MPC(7)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(9) and not i_MPC(6)) or
+                 (i_MPC(11) and i_MPC(8) and not i_MPC(7) and not i_MPC(6)
+                  and i_MPC(5)) or
+                 (i_MPC(11) and i_MPC(8) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4)) or
+                 (i_MPC(9) and not i_MPC(7) and not i_MPC(6) and i_MPC(5)) or
+                 (i_MPC(11) and i_MPC(8) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(9) and i_MPC(6) and not i_MPC(4) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and not i_MPC(4) and i_MPC(3)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(5) and i_MPC(2)) or
+                 (i_MPC(11) and i_MPC(10) and not i_MPC(7) and not i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(8) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(4) and not i_MPC(2) and not i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(7) and i_MPC(5) and not i_MPC(4)
+                  and i_MPC(2) and not i_MPC(1)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(7) and i_MPC(6) and not i_MPC(4)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(3) and i_MPC(2)) or
+                 (i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(2)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(5)
+                  and i_MPC(2) and not i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and not i_MPC(6)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9)
+                  and not i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(7) and not i_MPC(6) and i_MPC(3)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(4) and i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(9) and not i_MPC(8) and i_MPC(7)
+                  and i_MPC(4) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and not i_MPC(2) and not i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and i_MPC(5)
+                  and not i_MPC(4) and not i_MPC(3) and not i_MPC(2)
+                  and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(2)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(7)
+                  and not i_MPC(5) and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(6) and i_MPC(3)
+                  and i_MPC(1)) or
+                 (i_MPC(11) and not i_MPC(7) and i_MPC(6) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(7) and i_MPC(0)) or
+                 (not i_MPC(10) and i_MPC(7) and not i_MPC(5) and i_MPC(4)
+                  and i_MPC(2)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(8) and i_MPC(7)
+                  and i_MPC(6) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(7) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(9) and i_MPC(8) and i_MPC(6)
+                  and i_MPC(4) and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(8) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(6) and i_MPC(5)
+                  and i_MPC(2) and i_MPC(1)) or
+                 (not i_MPC(11) and not i_MPC(10) and not i_MPC(9)
+                  and i_MPC(4) and not i_MPC(3) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(9)
+                  and not i_MPC(8) and i_MPC(6) and not i_MPC(4)
+                  and i_MPC(1)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(7) and i_MPC(5) and i_MPC(4)
+                  and not i_MPC(1) and i_MPC(0)) or
+                 (i_MPC(9) and i_MPC(3) and i_MPC(0)) or
+                 (i_MPC(11) and not i_MPC(7) and not i_MPC(5) and i_MPC(3)) or
+                 (not i_MPC(10) and i_MPC(8) and not i_MPC(7)
+                  and not i_MPC(6)) or
+                 (not i_MPC(11) and not i_MPC(10) and i_MPC(9) and i_MPC(8)
+                  and not i_MPC(4)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(7)
+                  and not i_MPC(6) and not i_MPC(4)) or
+                 (not i_MPC(11) and i_MPC(6) and i_MPC(5) and i_MPC(4)
+                  and i_MPC(3)) or
+                 (i_MPC(11) and not i_MPC(10) and i_MPC(5) and i_MPC(3)
+                  and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(6) and not i_MPC(4) and i_MPC(2)
+                  and i_MPC(1)) or
+                 (not i_MPC(10) and i_MPC(6) and i_MPC(5) and not i_MPC(4)
+                  and i_MPC(2)) or
+                 (i_MPC(10) and not i_MPC(7) and not i_MPC(5) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(6) and not i_MPC(5) and i_MPC(3)
+                  and i_MPC(1)) or
+                 (i_MPC(8) and not i_MPC(7) and not i_MPC(4) and i_MPC(2)
+                  and i_MPC(0)) or
+                 (i_MPC(8) and not i_MPC(5) and i_MPC(2) and i_MPC(1)
+                  and not i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(10) and not i_MPC(8)
+                  and not i_MPC(6) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and not i_MPC(8) and i_MPC(6)
+                  and i_MPC(4) and i_MPC(0)) or
+                 (not i_MPC(11) and i_MPC(9) and i_MPC(8) and not i_MPC(4)
+                  and not i_MPC(2) and i_MPC(1)) or
+                 (i_MPC(11) and i_MPC(10) and i_MPC(7) and i_MPC(5)
+                  and i_MPC(2) and i_MPC(0)) or
+                 (i_MPC(11) and i_MPC(9) and i_MPC(7) and i_MPC(6)
+                  and not i_MPC(5) and i_MPC(4)) or
+                 (i_MPC(10) and i_MPC(9) and not i_MPC(5) and not i_MPC(3)
+                  and not i_MPC(1) and not i_MPC(0)) or
+                 (i_MPC(10) and i_MPC(7) and i_MPC(6) and not i_MPC(5)
+                  and not i_MPC(4) and i_MPC(2)) or
+                 (i_MPC(11) and not i_MPC(10) and not i_MPC(6) and i_MPC(5)
+                  and i_MPC(4) and i_MPC(1) and i_MPC(0)) or
+                 (not i_MPC(11) and not i_MPC(8) and not i_MPC(6)
+                  and not i_MPC(5) and not i_MPC(4) and not i_MPC(3)
+                  and i_MPC(1) and not i_MPC(0)) or
+                 (not i_MPC(10) and not i_MPC(9) and i_MPC(8)
+                  and not i_MPC(6) and not i_MPC(5) and not i_MPC(2)
+                  and not i_MPC(1) and not i_MPC(0));
+
+end Dataflow;
@@ -0,0 +1,161 @@
+-- BSD 3-Clause License
+-- 
+-- Copyright (c) 2018, Bernhard Vacarescu
+-- All rights reserved.
+-- 
+-- Redistribution and use in source and binary forms, with or without
+-- modification, are permitted provided that the following conditions are met:
+-- 
+-- * Redistributions of source code must retain the above copyright notice, this
+--   list of conditions and the following disclaimer.
+-- 
+-- * Redistributions in binary form must reproduce the above copyright notice,
+--   this list of conditions and the following disclaimer in the documentation
+--   and/or other materials provided with the distribution.
+-- 
+-- * Neither the name of the copyright holder nor the names of its
+--   contributors may be used to endorse or promote products derived from
+--   this software without specific prior written permission.
+-- 
+-- THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+-- AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+-- IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+-- DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+-- FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+-- DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+-- SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+-- CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+-- OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+-- OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+----------------------------------------------------------------------------------
+-- MEMORY ARBITER
+----------------------------------------------------------------------------------
+-- Connects two processors ("Processor") to one RAM port. Both processors use
+-- the same clock phases (same input clock), i_CLK is o_CLK_MEMORY (clk3), at
+-- which the RAM takes the address. In every microcycle one processor that 
+-- reads or writes gets the RAM (o_GRANT), the other one that also accesses
+-- the RAM gets a cleared o_READY and repeats its microinstruction in the next
+-- microcycle. If both processors access the RAM:
+--    g_policy = "FIXED": processor 0 first
+--    g_policy = "ROUND_ROBIN": the processor that was not served last
+-- A granted access with a set lock (TAS, i_LOCK) keeps the RAM for this 
+-- processor until its lock is cleared (after its write), so the read and the
+-- write of TAS are atomic.
+-- i_READY is the ready of the RAM (variable latency, see "Processor"): an
+-- access that is not finished keeps the RAM for its processor, which gets a
+-- cleared o_READY until the RAM is ready. A read of the prefetch queue is 
+-- dropped instead of repeated, the RAM is then free again in the next 
+-- microcycle without request of this processor.
+-- Both processors start at address 0 (RESET vector). The addresses 0 to 3 
+-- (vector of the RESET) of processor 1 are mapped to g_reset_vector_1, so
+-- each processor has its own RESET vector (the other vectors are shared).
+-- The data bus is not part of the arbiter: the read data goes to both 
+-- processors, the write data is the one of o_GRANT.
+----------------------------------------------------------------------------------
+
+library IEEE;
+use IEEE.STD_LOGIC_1164.ALL;
+use IEEE.NUMERIC_STD.ALL;
+
+
+entity Memory_Arbiter is
+    Generic ( 
+      g_bit : positive := 8; -- data bus (address bus: 2*g_bit)
+      g_policy : string := "ROUND_ROBIN"; -- or "FIXED"
+      g_reset_vector_1 : natural := 16#0018# -- RESET vector of processor 1
+    );
+    Port ( 
+      i_CLK : in STD_LOGIC;
+      i_ADDRESS_0 : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+      i_RD_0 : in STD_LOGIC;
+      i_WR_0 : in STD_LOGIC;
+      i_LOCK_0 : in STD_LOGIC;
+      o_READY_0 : out STD_LOGIC;
+      i_ADDRESS_1 : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+      i_RD_1 : in STD_LOGIC;
+      i_WR_1 : in STD_LOGIC;
+      i_LOCK_1 : in STD_LOGIC;
+      o_READY_1 : out STD_LOGIC;
+      o_ADDRESS : out STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+      o_RD : out STD_LOGIC;
+      o_WR : out STD_LOGIC;
+      o_GRANT : out STD_LOGIC; -- '0': processor 0, '1': processor 1
+      i_READY : in STD_LOGIC := '1' -- access of o_GRANT finished
+    );
+end Memory_Arbiter;
+
+
+
+architecture Behavioral of Memory_Arbiter is
+
+    -- size of one entry of the vector table
+    constant c_vector_size : natural := 4;
+
+    signal w_req_0 : STD_LOGIC;
+    signal w_req_1 : STD_LOGIC;
+    signal w_grant : STD_LOGIC;
+    signal w_req_grant : STD_LOGIC;
+    signal w_lock_grant : STD_LOGIC;
+    signal w_address_1 : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+    
+    -- processor that was served last (round robin)
+    signal r_LAST : STD_LOGIC := '1';
+    -- RAM held for r_HOLD_CORE (lock or access not finished)
+    signal r_HOLD : STD_LOGIC := '0';
+    signal r_HOLD_CORE : STD_LOGIC := '0';
+
+begin
+
+    -- synthesis translate_off
+    assert (g_policy = "ROUND_ROBIN" OR g_policy = "FIXED")
+    report("Generic error: g_policy has to be ROUND_ROBIN or FIXED!")
+    severity failure;
+    -- synthesis translate_on
+
+    w_req_0 <= i_RD_0 OR i_WR_0;
+    w_req_1 <= i_RD_1 OR i_WR_1;
+    
+    w_grant <= r_HOLD_CORE when r_HOLD = '1' else
+               '1' when w_req_0 = '0' AND w_req_1 = '1' else
+               '0' when w_req_1 = '0' OR g_policy = "FIXED" else
+               NOT(r_LAST);
+    
+    w_req_grant <= w_req_1 when w_grant = '1' else w_req_0;
+    w_lock_grant <= i_LOCK_1 when w_grant = '1' else i_LOCK_0;
+    
+    
+    PROC_arbiter: process (i_CLK)
+    begin
+      if rising_edge(i_CLK) then
+        if w_req_grant = '1' then
+          r_LAST <= w_grant;
+        end if;
+        
+        if w_req_grant = '1' AND (w_lock_grant = '1' OR i_READY = '0') then
+          r_HOLD <= '1';
+          r_HOLD_CORE <= w_grant;
+        elsif w_lock_grant = '0' then
+          r_HOLD <= '0';
+        end if;
+      end if;
+    end process PROC_arbiter;
+    
+    
+    -- RESET vector of processor 1
+    w_address_1 <= STD_LOGIC_VECTOR(to_unsigned(g_reset_vector_1, 2*g_bit) +
+                                    UNSIGNED(i_ADDRESS_1))
+                     when UNSIGNED(i_ADDRESS_1) < c_vector_size else
+                   i_ADDRESS_1;
+    
+    o_ADDRESS <= w_address_1 when w_grant = '1' else i_ADDRESS_0;
+    o_RD <= i_RD_1 when w_grant = '1' else i_RD_0;
+    o_WR <= i_WR_1 when w_grant = '1' else i_WR_0;
+    o_GRANT <= w_grant;
+    
+    -- an access is finished if the processor gets the RAM and the RAM is ready
+    o_READY_0 <= NOT(w_req_0) OR (NOT(w_grant) AND i_READY);
+    o_READY_1 <= NOT(w_req_1) OR (w_grant AND i_READY);
+
+end Behavioral;
@@ -35,18 +35,47 @@
 -- Based on the jump-condition of a microinstruction and the Z-flag-
 -- and N-flag value (from the ALU) it is determined if a jump in the 
 -- micro-program-memory should be performed.
+-- If i_FLAG_SEL is set (selected by the auxiliary command in the C-field of
+-- the MIR) the C-flag is used instead of the N-flag and the V-flag instead of
+-- the Z-flag, so also a carry or an overflow can be tested in one cycle.
+-- Additionally a small micro-return stack allows micro-subroutines: if the 
+-- OP-bit is set the condition bits are not used for a jump but select:
+--    "00", "11": MPC <- f(IR) (dispatch of the instruction)
+--    "01": call, MPC <- ADDRESS of MIR and MPC+1 is pushed onto the stack
+--    "10": return, MPC <- top of stack (stack is popped)
+-- The stack is a shift register which is loaded together with the MPC (clk5),
+-- so there is no stack pointer and it does not need a reset (the microcode 
+-- only calls subroutines within an instruction, so the stack is always empty 
+-- at the EVENT CHECK). If i_HOLD is set the MPC is not loaded (WAIT or a RAM
+-- access that is repeated), so the stack is not changed either.
+-- The output is the select value for the MMux:
+--    "00": MPC+1, "01": f(IR), "10": ADDRESS of MIR, "11": top of stack
 ----------------------------------------------------------------------------------
 
 library IEEE;
 use IEEE.STD_LOGIC_1164.ALL;
 
 
+-- g_address_size: bit size of the MPM address (MPC)
+-- g_stack_depth: number of nested micro-subroutine calls
 entity Microsequencer is
+    Generic (
+      g_address_size : positive := 12;
+      g_stack_depth : positive := 4
+    );
     Port ( 
+      i_CLK : in STD_LOGIC; -- CLK5 (same clock as MPC)
+      i_HOLD : in STD_LOGIC := '0'; -- MPC is not loaded
       i_Z : in STD_LOGIC;
       i_N : in STD_LOGIC;
+      i_C : in STD_LOGIC;
+      i_V : in STD_LOGIC;
+      i_FLAG_SEL : in STD_LOGIC; -- '0': N and Z, '1': C and V
+      i_OP : in STD_LOGIC;
       i_COND : in STD_LOGIC_VECTOR (1 downto 0);
-      o_J : out STD_LOGIC 
+      i_RETURN_ADDRESS : in STD_LOGIC_VECTOR (g_address_size-1 downto 0);
+      o_RETURN_ADDRESS : out STD_LOGIC_VECTOR (g_address_size-1 downto 0);
+      o_MMUX_SEL : out STD_LOGIC_VECTOR (1 downto 0)
     );
 end Microsequencer;
 
@@ -54,31 +83,102 @@ end Microsequencer;
 
 architecture Behavioral of Microsequencer is
 
+    type t_STACK is array (0 to g_stack_depth-1) 
+        of STD_LOGIC_VECTOR (g_address_size-1 downto 0);
+    
+    signal r_STACK : t_STACK := (others => (others => '0'));
+    
+    signal w_j : STD_LOGIC;
+    signal w_n_c : STD_LOGIC; -- tested flag for condition "01"
+    signal w_z_v : STD_LOGIC; -- tested flag for condition "10"
+    signal w_call : STD_LOGIC;
+    signal w_return : STD_LOGIC;
+    
+    -- synthesis translate_off
+    signal r_stack_level : natural range 0 to g_stack_depth := 0;
+    -- synthesis translate_on
+
 begin
  
-    process (i_Z, i_N, i_COND)
+    w_n_c <= i_C when i_FLAG_SEL = '1' else i_N;
+    w_z_v <= i_V when i_FLAG_SEL = '1' else i_Z;
+ 
+    process (w_z_v, w_n_c, i_COND)
     begin
-      o_J <= '0'; -- default
+      w_j <= '0'; -- default
     
       case i_COND is
         when "00" =>
-          o_J <= '0';
+          w_j <= '0';
         when "01" =>
-          if i_N = '1' then  
-            o_J <= '1';     
+          if w_n_c = '1' then  
+            w_j <= '1';     
           end if;
           -- no else necessary, because default value used
           -- (otherwise latch would be inferred)
         when "10" =>
-          if i_Z = '1' then 
-            o_J <= '1';
+          if w_z_v = '1' then 
+            w_j <= '1';
           end if;      
         when "11" =>
-          o_J <= '1';
+          w_j <= '1';
         when others =>
-          o_J <= '0';
+          w_j <= '0';
        end case;
 
     end process;
+    
+    w_call <= '1' when (i_OP = '1' AND i_COND = "01") else '0';
+    w_return <= '1' when (i_OP = '1' AND i_COND = "10") else '0';
+    
+    -- MMux select
+    PROC_mmux_sel: process (i_OP, w_j, w_call, w_return)
+    begin
+      if w_call = '1' then
+        o_MMUX_SEL <= "10";
+      elsif w_return = '1' then
+        o_MMUX_SEL <= "11";
+      elsif i_OP = '1' then
+        o_MMUX_SEL <= "01";
+      else
+        o_MMUX_SEL <= w_j & '0';
+      end if;
+    end process PROC_mmux_sel;
+    
+    
+    -- micro-return stack
+    PROC_stack: process (i_CLK)
+    begin
+      if rising_edge(i_CLK) then
+        if i_HOLD = '1' then
+          null;
+        elsif w_call = '1' then
+          -- synthesis translate_off
+          assert(r_stack_level < g_stack_depth)
+          report("Microsequencer: stack overflow! (microcode wrong)")
+          severity failure;
+          r_stack_level <= r_stack_level + 1;
+          -- synthesis translate_on
+          
+          r_STACK(0) <= i_RETURN_ADDRESS;
+          for i in 1 to g_stack_depth-1 loop
+            r_STACK(i) <= r_STACK(i-1);
+          end loop;
+        elsif w_return = '1' then
+          -- synthesis translate_off
+          assert(r_stack_level > 0)
+          report("Microsequencer: stack underflow! (microcode wrong)")
+          severity failure;
+          r_stack_level <= r_stack_level - 1;
+          -- synthesis translate_on
+        
+          for i in 0 to g_stack_depth-2 loop
+            r_STACK(i) <= r_STACK(i+1);
+          end loop;
+        end if;
+      end if;
+    end process PROC_stack;
+    
+    o_RETURN_ADDRESS <= r_STACK(0);
 
 end Behavioral;
@@ -0,0 +1,186 @@
+-- BSD 3-Clause License
+-- 
+-- Copyright (c) 2018, Bernhard Vacarescu
+-- All rights reserved.
+-- 
+-- Redistribution and use in source and binary forms, with or without
+-- modification, are permitted provided that the following conditions are met:
+-- 
+-- * Redistributions of source code must retain the above copyright notice, this
+--   list of conditions and the following disclaimer.
+-- 
+-- * Redistributions in binary form must reproduce the above copyright notice,
+--   this list of conditions and the following disclaimer in the documentation
+--   and/or other materials provided with the distribution.
+-- 
+-- * Neither the name of the copyright holder nor the names of its
+--   contributors may be used to endorse or promote products derived from
+--   this software without specific prior written permission.
+-- 
+-- THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+-- AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+-- IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+-- DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+-- FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+-- DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+-- SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+-- CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+-- OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+-- OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+----------------------------------------------------------------------------------
+-- PERFORMANCE COUNTER
+----------------------------------------------------------------------------------
+-- Five free-running counters (4*g_bit bit each) for the profiling of a 
+-- program, incremented at the rising edge of i_CLK (o_CLK_MEMORY of the 
+-- processor, one edge per cycle of the processor):
+--    CYCLES        every clock cycle (also WAI and stalls)
+--    INSTRUCTIONS  i_RETIRE (an instruction is decoded, o_RETIRE)
+--    READS         i_PROC_RD AND i_PROC_READY (finished read of the 
+--                  processor, also of a register like these)
+--    WRITES        i_PROC_WR AND i_PROC_READY
+--    INTERRUPTS    i_INT_TAKEN (routine of an interrupt line entered, 
+--                  o_INT_TAKEN)
+-- The counters are copied into the readable registers by a write of CTRL, so
+-- the program reads a consistent snapshot with several instructions. The 
+-- registers are placed at g_base_address (offset, g_bit bit each):
+--    0      CTRL          bit 0: latch (copy all counters), bit 1: clear 
+--                         (all counters are set to 0, after the copy if both 
+--                         bits are set), read as 0
+--    1-4    CYCLES        latched counter, most significant word first
+--    5-8    INSTRUCTIONS
+--    9-12   READS
+--    13-16  WRITES
+--    17-20  INTERRUPTS
+-- The register bus is the one of the RAM (like "Timer"): i_WR writes i_DATA 
+-- at the rising edge of i_CLK, o_DATA is the content of the addressed 
+-- register (asynchronous), o_SELECTED is set if i_ADDRESS is one of the 
+-- registers (the RAM must not answer then).
+-- The counters themselves are outputs (o_CYCLES to o_INTERRUPTS) for a 
+-- testbench or a display.
+----------------------------------------------------------------------------------
+
+library IEEE;
+use IEEE.STD_LOGIC_1164.ALL;
+use IEEE.NUMERIC_STD.ALL;
+
+
+entity Performance_Counter is
+    Generic ( 
+      g_bit : positive := 8; -- data bus (address bus: 2*g_bit)
+      g_base_address : natural := 16#FE10#
+    );
+    Port ( 
+      i_CLK : in STD_LOGIC;
+      -- register access
+      i_ADDRESS : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+      i_DATA : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
+      i_WR : in STD_LOGIC;
+      o_DATA : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+      o_SELECTED : out STD_LOGIC;
+      -- counted events of the processor
+      i_RETIRE : in STD_LOGIC;
+      i_PROC_RD : in STD_LOGIC;
+      i_PROC_WR : in STD_LOGIC;
+      i_PROC_READY : in STD_LOGIC := '1';
+      i_INT_TAKEN : in STD_LOGIC;
+      -- free-running counters
+      o_CYCLES : out STD_LOGIC_VECTOR (4*g_bit-1 downto 0);
+      o_INSTRUCTIONS : out STD_LOGIC_VECTOR (4*g_bit-1 downto 0);
+      o_READS : out STD_LOGIC_VECTOR (4*g_bit-1 downto 0);
+      o_WRITES : out STD_LOGIC_VECTOR (4*g_bit-1 downto 0);
+      o_INTERRUPTS : out STD_LOGIC_VECTOR (4*g_bit-1 downto 0)
+    );
+end Performance_Counter;
+
+
+
+architecture Behavioral of Performance_Counter is
+
+    -- counters (index) and words per counter
+    constant c_cycles : natural := 0;
+    constant c_instructions : natural := 1;
+    constant c_reads : natural := 2;
+    constant c_writes : natural := 3;
+    constant c_interrupts : natural := 4;
+    constant c_counters : natural := 5;
+    constant c_words : natural := 4;
+    
+    -- register offsets
+    constant c_ctrl : natural := 0;
+    constant c_last : natural := c_counters * c_words;
+    
+    type t_COUNTERS is array (0 to c_counters-1) of 
+        UNSIGNED (c_words*g_bit-1 downto 0);
+    
+    signal r_COUNT : t_COUNTERS := (others => (others => '0'));
+    signal r_LATCH : t_COUNTERS := (others => (others => '0'));
+    
+    signal w_event : STD_LOGIC_VECTOR (0 to c_counters-1);
+    
+    -- offset of the addressed register (only valid if w_selected is set)
+    signal w_offset : natural range 0 to c_last;
+    signal w_selected : STD_LOGIC;
+    signal w_write : STD_LOGIC;
+
+begin
+
+    w_selected <= '1' when (UNSIGNED(i_ADDRESS) >= g_base_address AND
+                            UNSIGNED(i_ADDRESS) <= g_base_address + c_last)
+                  else '0';
+    w_offset <= to_integer(UNSIGNED(i_ADDRESS) - g_base_address) 
+                  when w_selected = '1' else 0;
+    w_write <= i_WR AND w_selected;
+    
+    w_event(c_cycles) <= '1';
+    w_event(c_instructions) <= i_RETIRE;
+    w_event(c_reads) <= i_PROC_RD AND i_PROC_READY;
+    w_event(c_writes) <= i_PROC_WR AND i_PROC_READY;
+    w_event(c_interrupts) <= i_INT_TAKEN;
+    
+    
+    PROC_counter: process (i_CLK)
+    begin
+      if rising_edge(i_CLK) then
+        -- latch
+        if w_write = '1' AND w_offset = c_ctrl AND i_DATA(0) = '1' then
+          r_LATCH <= r_COUNT;
+        end if;
+        
+        -- counting, clear has priority
+        for i in 0 to c_counters-1 loop
+          if w_write = '1' AND w_offset = c_ctrl AND i_DATA(1) = '1' then
+            r_COUNT(i) <= (others => '0');
+          elsif w_event(i) = '1' then
+            r_COUNT(i) <= r_COUNT(i) + 1;
+          end if;
+        end loop;
+      end if;
+    end process PROC_counter;
+    
+    
+    -- read access (word (offset - 1) mod c_words of the latched counter
+    -- (offset - 1) / c_words, most significant word first)
+    PROC_read: process (w_offset, r_LATCH)
+      variable v_counter : natural range 0 to c_counters-1;
+      variable v_word : natural range 0 to c_words-1;
+    begin
+      o_DATA <= (others => '0');
+      if w_offset /= c_ctrl then
+        v_counter := (w_offset - 1) / c_words;
+        v_word := c_words - 1 - ((w_offset - 1) mod c_words);
+        o_DATA <= STD_LOGIC_VECTOR(
+                    r_LATCH(v_counter)((v_word+1)*g_bit-1 downto v_word*g_bit));
+      end if;
+    end process PROC_read;
+    
+    o_SELECTED <= w_selected;
+    
+    o_CYCLES <= STD_LOGIC_VECTOR(r_COUNT(c_cycles));
+    o_INSTRUCTIONS <= STD_LOGIC_VECTOR(r_COUNT(c_instructions));
+    o_READS <= STD_LOGIC_VECTOR(r_COUNT(c_reads));
+    o_WRITES <= STD_LOGIC_VECTOR(r_COUNT(c_writes));
+    o_INTERRUPTS <= STD_LOGIC_VECTOR(r_COUNT(c_interrupts));
+
+end Behavioral;
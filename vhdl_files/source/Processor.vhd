@@ -34,7 +34,8 @@
 ----------------------------------------------------------------------------------
 -- included part(s): 
 --    ALU, MBR, MICROSEQUENCER, MUX (MMux and AMux), EVENT CONTROLLER,
---    MMCM UNIT WRAPPER (block design for clock generator)
+--    INTERRUPT CONTROLLER, MMCM UNIT WRAPPER (block design for clock 
+--    generator)
 ----------------------------------------------------------------------------------
 -- Very general description of the processor architecture. Some parts could be
 -- changed using generic values. 
@@ -43,7 +44,27 @@
 -- bits).
 -- An external reset button can reset the processor using microcode (the RAM
 -- does not change to its start up value!).
--- One (or more interrupt lines) are available.
+-- One (or more interrupt lines) are available. Every line has an enable bit
+-- and a priority (interrupt controller, registers 21 to 23), an interrupt
+-- routine runs at the priority level of its line (bits 7 to 5 of CC).
+-- An interrupt (or SWI) switches to a second bank of the general registers
+-- (shadow bank), RTI switches back. Only a nested interrupt saves PC and CC on 
+-- the stack.
+-- WAI holds the MIR and the MPC until an event occurs (no microinstruction is
+-- executed, no RAM access), the event is then served without delay.
+-- A RAM access that is not finished (i_READY cleared at clk3, e.g. the RAM is
+-- used by another processor or needs wait states) is repeated in the next 
+-- microcycle: the MIR and the MPC are held and no register of the processor 
+-- is loaded (like WAI). An access cannot finish before clk3. A read of the
+-- prefetch queue (o_QUEUE_RD) is not repeated: without i_READY the queue 
+-- drops the byte and reads it again in a later step without memory operation
+-- (the microinstruction is not held).
+-- TAS sets o_LOCK from its read until its write, so an arbiter does not give
+-- the RAM to another processor in between.
+-- For profiling (see "Performance_Counter") o_RETIRE is set in the microcycle
+-- that decodes an instruction (MPC <- f(IR)) and o_INT_TAKEN in the one that
+-- enters the routine of an interrupt line (write of EVENT), both only in the
+-- first cycle if the microcycle is repeated (cleared READY).
 -- The Basys3 board offers a 100 MHz clock. The ClockGenerator module reduces
 -- the clock speed to 10 MHz, which is also output of the clock generator and is 
 -- then treated as if this would have been the actual input clock ("virtual 
@@ -54,19 +75,68 @@ library IEEE;
 use IEEE.STD_LOGIC_1164.ALL;
 use IEEE.NUMERIC_STD.ALL;
 
+use STD.TEXTIO.ALL;
+use ieee.std_logic_textio.all;
+
 library work;
 use work.datatypes.all;
 use work.functions.all;
 
--- g_bit: architecture type (standard: 8-bit architecture)
+-- g_bit: architecture type (standard: 8-bit architecture, 16 possible)
 --    The architecture type also effects the possible accessible 
 --    address range of the RAM.
+--    All registers, the ALU, the MBR and the data bus have g_bit bits, the 
+--    MAR, the PC and the SP (address bus) 2*g_bit bits. The microcode is the
+--    same for every g_bit (the constant registers scale with g_bit), so a 
+--    16 bit processor moves 16 bit words per microinstruction: a memory word,
+--    an immediate value and an address offset have 16 bit, an address two
+--    words. The opcode is the lower byte of the IR (the upper byte is 
+--    ignored), so g_bit has to be at least 8.
 -- g_interrupt_line_size: number of external interrupt lines (e.g. buttons)
---    According to the code there has to be at least 1 interrupt line.
+--    According to the code there has to be at least 1 interrupt line. The 
+--    vector table needs 4 * (g_interrupt_line_size + 2) bytes (created by 
+--    the "vector_table_creator").
+-- g_direct_interrupt_lines: the last interrupt lines that are connected to
+--    internal peripherals (e.g. "Timer"), they are not debounced
 -- g_debounce_counter_bit_size: bit size of counter used for debouncing reset
 --    and interrupt buttons.
 --    For debouncing of about 10 ms for 10 MHz clock speed a 17 bit-counter
 --    is needed.
+--    All lines share a prescaler and only have a small counter each, the 
+--    debounce time is up to 1/8 longer (see "Event_Controller").
+-- g_mpm_style: implementation of the microprogram memory (MPM)
+--    "BLOCK": one ROM (4096 x 40 bit) initialized by "ROM_MEM.txt"
+--    "NANO":  two-level store, the microstore ("MICRO_MEM.txt") holds an
+--             index into the nanostore ("NANO_MEM.txt", unique control
+--             words) and the jump address. The nanostore is read
+--             asynchronously after clk1, so the control fields of the MIR 
+--             are valid one LUT-ROM delay later (still within the clk1 to 
+--             clk2 phase).
+--    Both files are created by the "nanostore_creator" from "ROM_MEM.txt".
+--    "LOGIC": every MIR bit is a two-level function of the MPC (module 
+--             "MPM_Logic", created by the "logic_rom_creator" from 
+--             "ROM_MEM.txt"), the MIR is loaded at clk1 like for "BLOCK"
+--    "PREFETCH": one dual-port ROM initialized by "ROM_MEM.txt". At clk4 
+--             both possible next microinstructions are read (port A: MPC+1,
+--             port B: jump address, dispatch address or return address), at
+--             clk5 the sequencer selects one of them and loads it into the 
+--             MIR together with the MPC. The MPM read is overlapped with the
+--             ALU operation, the MIR is valid at clk5 instead of clk1 (clk1
+--             is then not used). 
+-- g_nano_index_size: bit size of the nanostore index (only used for "NANO",
+--    printed by the "nanostore_creator")
+-- g_micro_stack_depth: number of nested micro-subroutine calls (micro-return
+--    stack of the microsequencer, the microcode uses one level)
+-- g_adder_style: adder of the ALU ("RIPPLE", "CLA", "CARRY_SELECT" or 
+--    "KOGGE_STONE", see module "Adder"). The adder is on the path from the 
+--    A/B-latches (clk2) to the flag registers and the C-bus (clk4).
+-- g_queue_depth: number of bytes of the instruction prefetch queue (module 
+--    "Communication", 0: no queue). The queue reads the bytes following the
+--    last "take next byte" in steps without memory operation, so its reads 
+--    are also visible on the address bus (o_RD and o_QUEUE_RD set). Writes
+--    of other masters of the RAM (DMA, second processor) have to be given
+--    to i_SNOOP_WR and i_SNOOP_ADDRESS (valid at o_CLK_MEMORY), otherwise 
+--    the queue may keep the old bytes of a changed program.
 --
 -- Changing one of the other generics would need bigger changes in the
 -- architecture! (Size of MPM, microcode, number of internal registers,...)
@@ -81,7 +151,13 @@ entity Processor is
     Generic( 
       g_bit : positive := 8;
       g_interrupt_line_size : positive := 2;
+      g_direct_interrupt_lines : natural := 0;
       g_debounce_counter_bit_size : positive := 17; 
+      g_mpm_style : string := "BLOCK";
+      g_nano_index_size : positive := 8;
+      g_micro_stack_depth : positive := 4;
+      g_adder_style : string := "RIPPLE";
+      g_queue_depth : natural := 4;
       g_dec_sel_size : positive := 5;
       g_mmux_bus_size : positive := 12;
       g_mmux_sel_size : positive := 2;
@@ -94,6 +170,14 @@ entity Processor is
       o_ADDRESS : out STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
       o_RD : out STD_LOGIC;
       o_WR : out STD_LOGIC;
+      o_QUEUE_RD : out STD_LOGIC;  -- o_RD is a read of the prefetch queue
+      i_READY : in STD_LOGIC := '1';  -- RAM access of this microcycle done
+      o_LOCK : out STD_LOGIC;  -- RAM must not be given to another processor
+      o_RETIRE : out STD_LOGIC;  -- instruction decoded
+      o_INT_TAKEN : out STD_LOGIC;  -- routine of an interrupt line entered
+      i_SNOOP_WR : in STD_LOGIC := '0';  -- RAM write of any master
+      i_SNOOP_ADDRESS : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0) 
+          := (others => '0');
       o_CLK_MEMORY : out STD_LOGIC;  -- clock for RAM operations
       o_CLK_MAIN : out STD_LOGIC;  -- "virtual input clock" (reduced speed)
       io_DATA : inout STD_LOGIC_VECTOR (g_bit-1 downto 0)  -- connection to RAM
@@ -104,8 +188,11 @@ end Processor;
 
 architecture Mixed of Processor is
     
-    -- output of the event controller, can be loaded into EVENT register
+    -- output of the event controller (reset event) and of the interrupt 
+    -- controller, which is loaded into the EVENT register
     signal w_event_control : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_int_pulse : STD_LOGIC_VECTOR (1 to g_interrupt_line_size);
+    signal w_int_event : STD_LOGIC_VECTOR (g_bit-1 downto 0);
   
     -- derived clock lines via MMCM
     signal w_clks : STD_LOGIC_VECTOR (1 to 5);
@@ -132,9 +219,7 @@ architecture Mixed of Processor is
      15 => (g_bit-1 => '1', others => '0'), -- EVENT (no event status)
      -- CONSTANT REGISTERS (removed as registers at synthesis)
      20 => (g_bit-1 => '1', others => '0'), -- no event status
-     21 => STD_LOGIC_VECTOR(to_signed(-5, g_bit)),  -- -5 / 251
-     22 => STD_LOGIC_VECTOR(to_signed(-4, g_bit)),  -- -4 / 252
-     23 => STD_LOGIC_VECTOR(to_signed(-3, g_bit)),  -- -3 / 253
+     -- 21 to 23: ISEL, ICTRL, IENTRY (interrupt controller)
      24 => STD_LOGIC_VECTOR(to_signed(-2, g_bit)),  -- -2 / 254
      25 => STD_LOGIC_VECTOR(to_signed(-1, g_bit)),  -- -1 / 255
      26 => STD_LOGIC_VECTOR(to_unsigned(16, g_bit)),-- 16
@@ -146,11 +231,30 @@ architecture Mixed of Processor is
       others => (others => '0')
     );
     
-    -- only for signal rom_style can be defined (not for a constant)
-    signal r_MPM : t_ROM := initROM("..\..\..\ROM_File\ROM_MEM.txt");
+    -- second bank of the general registers (interrupt context), only the 
+    -- registers marked in c_banked are used (the others are removed at 
+    -- synthesis)
+    signal r_SHADOW : t_REG := (
+      9 => (4 => '1', others => '0'), -- CC (interrupts disabled)
+      others => (others => '0')
+    );
+    
+    -- YRH, YRL, XRH, XRL, PCH, PCL, AC, CC, DH and DL are banked
+    constant c_banked : STD_LOGIC_VECTOR (0 to 2**g_dec_sel_size-1) := 
+        (0 to 3 => '1', 6 to 9 => '1', 16 to 17 => '1', others => '0');
+    
+    -- '1': the shadow bank is used, r_NEST counts the interrupts that were 
+    -- entered while the shadow bank was already used (context on the stack)
+    signal r_BANK : STD_LOGIC := '0';
+    signal r_NEST : UNSIGNED (2*g_bit-1 downto 0) := (others => '0');
+    -- '1': the last bank command switched the bank
+    signal r_BANK_SWITCH : STD_LOGIC := '0';
+    
+    -- registers as seen by the A- and B-decoder (active bank, registers of
+    -- the interrupt controller)
+    signal w_view : t_REG;
     
     attribute rom_style : string;   
-    attribute rom_style of r_MPM : signal is "block";
        
   -------------------------------------------------------------------------------- 
   -- further registers
@@ -159,7 +263,8 @@ architecture Mixed of Processor is
     signal r_A_REG : STD_LOGIC_VECTOR (g_bit-1 downto 0) := (others => '0');
     signal r_B_REG : STD_LOGIC_VECTOR (g_bit-1 downto 0) := (others => '0');
 
-    signal r_MPC : STD_LOGIC_VECTOR (11 downto 0) := "000000000000";
+    signal r_MPC : STD_LOGIC_VECTOR (g_mmux_bus_size-1 downto 0) 
+        := (others => '0');
     
     -- initial value: jump to address 0x000 in MPM; processor can only start
     -- if other value is loaded into MIR
@@ -179,7 +284,7 @@ architecture Mixed of Processor is
     alias r_C_MIR : STD_LOGIC_VECTOR is r_MIR(26 downto 22);
     alias r_B_MIR : STD_LOGIC_VECTOR is r_MIR(21 downto 17);
     alias r_A_MIR : STD_LOGIC_VECTOR is r_MIR(16 downto 12);
-    alias r_ADDRESS_MIR : STD_LOGIC_VECTOR is r_MIR(11 downto 0);
+    alias r_ADDRESS_MIR : STD_LOGIC_VECTOR is r_MIR(g_mmux_bus_size-1 downto 0);
     
     
   -------------------------------------------------------------------------------- 
@@ -192,23 +297,101 @@ architecture Mixed of Processor is
     signal w_alu_a : STD_LOGIC_VECTOR (g_bit-1 downto 0);
     signal w_alu_z : STD_LOGIC;
     signal w_alu_n : STD_LOGIC;
+    signal w_alu_c : STD_LOGIC;
+    signal w_alu_v : STD_LOGIC;
     signal w_alu_out : STD_LOGIC_VECTOR (g_bit-1 downto 0); 
   
     signal w_mbr_to_amux : STD_LOGIC_VECTOR (g_bit-1 downto 0);
-    signal w_j_cond : STD_LOGIC;
+    signal w_return_address : STD_LOGIC_VECTOR (g_mmux_bus_size-1 downto 0);
+    signal w_flag_sel : STD_LOGIC;
+    signal w_pc_inc : STD_LOGIC;
+    signal w_pc : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+    signal w_pc_plus : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+    signal w_sp_push : STD_LOGIC;
+    signal w_sp_pull : STD_LOGIC;
+    signal w_sp_minus : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+    signal w_sp_plus : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+    signal w_mar_a : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_mar_b : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_bank_enter : STD_LOGIC;
+    signal w_bank_leave : STD_LOGIC;
+    signal w_bank_clear : STD_LOGIC;
+    signal w_wait : STD_LOGIC;
+    signal w_lock_cmd : STD_LOGIC;
+    signal w_hold : STD_LOGIC;
+    signal w_exec : STD_LOGIC;
+    signal w_rd : STD_LOGIC;
+    signal w_wr : STD_LOGIC;
+    
+    -- RAM access of the last microcycle not finished (i_READY at clk3)
+    signal r_MEM_STALL : STD_LOGIC := '0';
+    -- i_READY at clk3 (a read of the queue is dropped if it is cleared)
+    signal r_QUEUE_READY : STD_LOGIC := '1';
+    -- set by LOCK, cleared by the next write to the RAM
+    signal r_LOCK : STD_LOGIC := '0';
+    signal w_bank_switch : STD_LOGIC;
+    signal w_bank_next : STD_LOGIC;
+    signal w_seq_z : STD_LOGIC;
+    signal w_seq_n : STD_LOGIC;
     signal w_mmux_sel : STD_LOGIC_VECTOR (1 downto 0);
-    signal w_mpc_plus : STD_LOGIC_VECTOR (11 downto 0);
-    signal w_instruct : STD_LOGIC_VECTOR (11 downto 0);
-    signal w_mmux_to_mpc : STD_LOGIC_VECTOR (11 downto 0);
+    signal w_mpc_plus : STD_LOGIC_VECTOR (g_mmux_bus_size-1 downto 0);
+    signal w_instruct : STD_LOGIC_VECTOR (g_mmux_bus_size-1 downto 0);
+    signal w_mmux_to_mpc : STD_LOGIC_VECTOR (g_mmux_bus_size-1 downto 0);
+    signal w_queue_rd : STD_LOGIC;
+    signal w_address : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+    signal w_queue_hit : STD_LOGIC;
+    signal w_int_sel : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_int_ctrl : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_int_entry : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_int_taken : STD_LOGIC;
+    signal w_int_level : STD_LOGIC_VECTOR (2 downto 0);
+    signal w_int_reset : STD_LOGIC;
+    signal w_int_wr_sel : STD_LOGIC;
+    signal w_int_wr_ctrl : STD_LOGIC;
+    signal w_int_ack : STD_LOGIC;
    
     signal w_amux_in : t_MUX_ARRAY 
         (0 to 2**g_amux_sel_size-1, g_bit-1 downto 0);
     signal w_mmux_in : t_MUX_ARRAY 
         (0 to 2**g_mmux_sel_size-1, g_mmux_bus_size-1 downto 0);
     
+    -- bit size of the opcode (lower bits of the IR), every opcode has 16 
+    -- microinstructions in the MPM
+    constant c_opcode_size : positive := g_mmux_bus_size - 4;
+    
     -- constant used for interrupts (definition of no event)
     constant c_no_event : STD_LOGIC_VECTOR (g_bit-1 downto 0) 
         := (g_bit-1 => '1', others => '0');
+        
+    -- auxiliary commands (C-field of the MIR if ENC is cleared)
+    -- "11111": no command (default value of the microcode)
+    -- "11110": jump conditions use C- and V-flag (instead of N and Z)
+    -- "11101": PCH:PCL <- PCH:PCL + 1 (PC incrementer, the ALU is free)
+    -- "11100": SPH:SPL <- SPH:SPL - 1 (SP unit, push), a MAR load of the same 
+    --          microinstruction takes the new SP (MAR <- SP - 1)
+    -- "11011": SPH:SPL <- SPH:SPL + 1 (SP unit, pull), a MAR load of the same
+    --          microinstruction takes the old SP (MAR <- SP)
+    -- "11010": enter the shadow bank (interrupt entry), if it is already used
+    --          the nesting counter is increased instead
+    -- "11001": leave the shadow bank (RTI), if interrupts are nested the 
+    --          nesting counter is decreased instead (no change in bank 0)
+    --          For both commands the jump conditions use the bank switch: 
+    --          Z = 1 if the bank was switched, N = 1 if not (context on the
+    --          stack)
+    -- "11000": bank 0 and no nesting (reset)
+    -- "10111": wait for an event (WAI): MIR and MPC are held as long as the
+    --          EVENT register is "no event" (no MIR load, no RAM access), 
+    --          then the jump of the microinstruction is performed
+    -- "10110": lock the RAM (TAS) until the next write to the RAM
+    constant c_aux_sel_cv : STD_LOGIC_VECTOR (4 downto 0) := "11110";
+    constant c_aux_pc_inc : STD_LOGIC_VECTOR (4 downto 0) := "11101";
+    constant c_aux_sp_push : STD_LOGIC_VECTOR (4 downto 0) := "11100";
+    constant c_aux_sp_pull : STD_LOGIC_VECTOR (4 downto 0) := "11011";
+    constant c_aux_bank_enter : STD_LOGIC_VECTOR (4 downto 0) := "11010";
+    constant c_aux_bank_leave : STD_LOGIC_VECTOR (4 downto 0) := "11001";
+    constant c_aux_bank_clear : STD_LOGIC_VECTOR (4 downto 0) := "11000";
+    constant c_aux_wait : STD_LOGIC_VECTOR (4 downto 0) := "10111";
+    constant c_aux_lock : STD_LOGIC_VECTOR (4 downto 0) := "10110";
     
 begin
 
@@ -218,42 +401,64 @@ begin
   
     Communication_inst : entity work.Communication
       generic map ( 
-        g_bit => g_bit
+        g_bit => g_bit,
+        g_queue_depth => g_queue_depth
       )
       port map (
         i_CLK_MAR => w_clk3,
         i_CLK_MBR => w_clk4,
+        i_CLK_MEMORY => w_clk3,
+        i_ENABLE => w_exec,
+        i_QUEUE_READY => r_QUEUE_READY,
         i_CONTROL => r_COMMUNICATION_MIR,
         i_DATA_FROM_ALU => w_alu_out,
-        i_A_REG => r_A_REG,
-        i_B_REG => r_B_REG,
+        i_A_REG => w_mar_a,
+        i_B_REG => w_mar_b,
         o_DATA_TO_AMUX => w_mbr_to_amux,
-        o_ADDRESS => o_ADDRESS,
+        o_ADDRESS => w_address,
+        o_QUEUE_RD => w_queue_rd,
+        o_QUEUE_HIT => w_queue_hit,
+        i_SNOOP_WR => i_SNOOP_WR,
+        i_SNOOP_ADDRESS => i_SNOOP_ADDRESS,
         io_DATA_MEM => IO_DATA
       );
              
     Microsequencer_inst: entity work.Microsequencer
+      generic map (
+        g_address_size => g_mmux_bus_size,
+        g_stack_depth => g_micro_stack_depth
+      )
       port map ( 
-        i_Z => w_alu_z,
-        i_N => w_alu_n,
+        i_CLK => w_clk5,
+        i_HOLD => w_hold,
+        i_Z => w_seq_z,
+        i_N => w_seq_n,
+        i_C => w_alu_c,
+        i_V => w_alu_v,
+        i_FLAG_SEL => w_flag_sel,
+        i_OP => r_OP_MIR,
         i_COND => r_COND_MIR,
-        o_J => w_j_cond 
+        i_RETURN_ADDRESS => w_mpc_plus,
+        o_RETURN_ADDRESS => w_return_address,
+        o_MMUX_SEL => w_mmux_sel
       ); 
    
     ALU_inst: entity work.ALU
       generic map( 
-        g_bit => g_bit 
+        g_bit => g_bit,
+        g_adder_style => g_adder_style
       )
       port map ( 
         i_ALU_A => w_alu_a,
         i_ALU_B => r_B_REG,
         i_SEL => r_ALU_MIR,
         i_CLK => w_clk4,
+        i_ENABLE => w_exec,
         o_ALU_OUT => w_alu_out,
         o_Z_FLAG => w_alu_z,
         o_N_FLAG => w_alu_n,             
-        o_V_FLAG => open, -- ouput only used for simulation
-        o_C_FLAG => open  -- ouput only used for simulation
+        o_V_FLAG => w_alu_v,
+        o_C_FLAG => w_alu_c
       );
 
     ClockGenerator: entity work.MMCM_unit_wrapper
@@ -296,14 +501,38 @@ begin
       generic map ( 
         g_bit_size_counter => g_debounce_counter_bit_size,
         g_bit_size => g_bit,
-        g_int_lines => g_interrupt_line_size 
+        g_int_lines => g_interrupt_line_size,
+        g_direct_lines => g_direct_interrupt_lines
       )
       port map ( 
         i_RESET => i_RESET_PIN,
         i_CLK => w_main_clk,
         i_INTERRUPT => i_INTERRUPT,
+        o_INTERRUPT => w_int_pulse,
         o_event_control => w_event_control
       );
+      
+    InterruptController_inst: entity work.Interrupt_Controller
+      generic map ( 
+        g_bit => g_bit,
+        g_int_lines => g_interrupt_line_size 
+      )
+      port map ( 
+        i_CLK => w_clk4,
+        i_RESET => w_int_reset,
+        i_INTERRUPT => w_int_pulse,
+        i_LEVEL => w_int_level,
+        i_WR_SEL => w_int_wr_sel,
+        i_WR_CTRL => w_int_wr_ctrl,
+        i_DATA => w_alu_out,
+        i_ACK => w_int_ack,
+        i_SERVED => r_REGISTERS(19),
+        o_SEL => w_int_sel,
+        o_CTRL => w_int_ctrl,
+        o_ENTRY_CC => w_int_entry,
+        o_TAKEN => w_int_taken,
+        o_EVENT_CONTROL => w_int_event
+      );
     
     
   -------------------------------------------------------------------------------- 
@@ -318,31 +547,173 @@ begin
       end loop;
     end process PROC_amux_connect;
     
-    PROC_mmux_connect: process(w_mpc_plus, r_ADDRESS_MIR, w_instruct)
+    PROC_mmux_connect: process(w_mpc_plus, r_ADDRESS_MIR, w_instruct,
+        w_return_address)
     begin
       for i in 0 to g_mmux_bus_size-1 loop
         w_mmux_in(0,i) <= w_mpc_plus(i);
         w_mmux_in(1,i) <= w_instruct(i);
         w_mmux_in(2,i) <= r_ADDRESS_MIR(i);
-        w_mmux_in(3,i) <= w_instruct(i);
+        w_mmux_in(3,i) <= w_return_address(i);
       end loop;
     end process PROC_mmux_connect;
-    
-    w_mmux_sel(0) <= r_OP_MIR;
-    w_mmux_sel(1) <= w_j_cond;
                                                                                   
                                                                                   
   -------------------------------------------------------------------------------- 
   -- clocked processes (for communication (MAR and MBR) and ALU external modules) 
   --
   
-    -- load MIR
-    PROC_CLK1: process (w_clk1)
+    -- load MIR (one ROM)
+    MPM_BLOCK: if g_mpm_style = "BLOCK" generate
+      -- only for signal rom_style can be defined (not for a constant)
+      signal r_MPM : t_ROM (0 to 2**g_mmux_bus_size-1) := 
+          initRom("..\..\..\ROM_File\ROM_MEM.txt", 2**g_mmux_bus_size-1);
+    
+      attribute rom_style of r_MPM : signal is "block";
     begin
-      if rising_edge(w_clk1) then
-        r_MIR <= r_MPM(to_integer(UNSIGNED(r_MPC)));
-      end if;
-    end process PROC_CLK1;    
+      PROC_CLK1: process (w_clk1)
+      begin
+        if rising_edge(w_clk1) then
+          if w_hold = '0' then
+            r_MIR <= r_MPM(to_integer(UNSIGNED(r_MPC)));
+          end if;
+        end if;
+      end process PROC_CLK1;
+    end generate MPM_BLOCK;
+    
+    
+    -- load MIR (microstore and nanostore)
+    MPM_NANO: if g_mpm_style = "NANO" generate
+      type t_MICRO_ROM is array (0 to 2**g_mmux_bus_size-1) 
+          of STD_LOGIC_VECTOR (g_nano_index_size+g_mmux_bus_size-1 downto 0);
+      type t_NANO_ROM is array (0 to 2**g_nano_index_size-1) 
+          of STD_LOGIC_VECTOR (39 downto g_mmux_bus_size);
+          
+      impure function initMicroRom (RomFileName : in string) 
+          return t_MICRO_ROM is
+        FILE f_rom_file : TEXT open READ_MODE is RomFileName;
+        variable v_line_pointer_read : LINE;
+        variable v_temp_mem : t_MICRO_ROM;
+      begin
+        for i in t_MICRO_ROM'range loop
+          readline(f_rom_file, v_line_pointer_read);
+          read(v_line_pointer_read, v_temp_mem(i));
+        end loop;
+        file_close(f_rom_file); 
+        return v_temp_mem;
+      end function;
+      
+      impure function initNanoRom (RomFileName : in string) 
+          return t_NANO_ROM is
+        FILE f_rom_file : TEXT open READ_MODE is RomFileName;
+        variable v_line_pointer_read : LINE;
+        variable v_temp_mem : t_NANO_ROM;
+      begin
+        for i in t_NANO_ROM'range loop
+          readline(f_rom_file, v_line_pointer_read);
+          read(v_line_pointer_read, v_temp_mem(i));
+        end loop;
+        file_close(f_rom_file); 
+        return v_temp_mem;
+      end function;
+    
+      signal r_MICRO : t_MICRO_ROM 
+          := initMicroRom("..\..\..\ROM_File\MICRO_MEM.txt");
+      signal r_NANO : t_NANO_ROM 
+          := initNanoRom("..\..\..\ROM_File\NANO_MEM.txt");
+          
+      attribute rom_style of r_MICRO : signal is "block";
+      attribute rom_style of r_NANO : signal is "distributed";
+      
+      -- initial value: index 0 contains the control part of the initial MIR
+      -- value (jump to address 0x000)
+      signal r_MICRO_WORD : STD_LOGIC_VECTOR 
+          (g_nano_index_size+g_mmux_bus_size-1 downto 0) := (others => '0');
+    begin
+      PROC_CLK1: process (w_clk1)
+      begin
+        if rising_edge(w_clk1) then
+          if w_hold = '0' then
+            r_MICRO_WORD <= r_MICRO(to_integer(UNSIGNED(r_MPC)));
+          end if;
+        end if;
+      end process PROC_CLK1;
+      
+      -- nanostore decoding (asynchronous)
+      r_MIR <= r_NANO(to_integer(UNSIGNED(r_MICRO_WORD(
+                 g_nano_index_size+g_mmux_bus_size-1 downto g_mmux_bus_size))))
+               & r_MICRO_WORD(g_mmux_bus_size-1 downto 0);
+    end generate MPM_NANO;
+    
+    
+    -- load MIR (microprogram as combinational logic)
+    MPM_LOGIC: if g_mpm_style = "LOGIC" generate
+      signal w_mpm_logic : STD_LOGIC_VECTOR (39 downto 0);
+    begin
+      MPM_Logic_inst: entity work.MPM_Logic
+        port map (
+          i_MPC => r_MPC,
+          o_MIR => w_mpm_logic
+        );
+        
+      PROC_CLK1: process (w_clk1)
+      begin
+        if rising_edge(w_clk1) then
+          if w_hold = '0' then
+            r_MIR <= w_mpm_logic;
+          end if;
+        end if;
+      end process PROC_CLK1;
+    end generate MPM_LOGIC;
+    
+
+    -- load MIR (dual-port ROM, both possible next MIRs are read in advance)
+    MPM_PREFETCH: if g_mpm_style = "PREFETCH" generate
+      -- only for signal rom_style can be defined (not for a constant)
+      signal r_MPM : t_ROM (0 to 2**g_mmux_bus_size-1) := 
+          initRom("..\..\..\ROM_File\ROM_MEM.txt", 2**g_mmux_bus_size-1);
+    
+      attribute rom_style of r_MPM : signal is "block";
+      
+      -- address of the jump (not depending on the flags), IR is forwarded 
+      -- from the ALU if it is loaded by the same microinstruction (clk4)
+      signal w_target : STD_LOGIC_VECTOR (g_mmux_bus_size-1 downto 0);
+      
+      -- port A: next microinstruction, port B: jump target
+      signal r_MIR_NEXT : STD_LOGIC_VECTOR (39 downto 0) := (others => '0');
+      signal r_MIR_TARGET : STD_LOGIC_VECTOR (39 downto 0) := (others => '0');
+    begin
+      w_target <= r_ADDRESS_MIR 
+                      when (r_OP_MIR = '0' OR r_COND_MIR = "01") else
+                  w_return_address 
+                      when r_COND_MIR = "10" else
+                  w_alu_out(c_opcode_size-1 downto 0) & "0000"
+                      when (r_ENC_MIR = '1' AND 
+                            to_integer(UNSIGNED(r_C_MIR)) = 14)
+                      else w_instruct;
+    
+      PROC_CLK4_MPM: process (w_clk4)
+      begin
+        if rising_edge(w_clk4) then
+          r_MIR_NEXT <= r_MPM(to_integer(UNSIGNED(w_mpc_plus)));
+          r_MIR_TARGET <= r_MPM(to_integer(UNSIGNED(w_target)));
+        end if;
+      end process PROC_CLK4_MPM;
+      
+      -- MMux selects MPC+1 (0) or one of the jump addresses (1 to 3), both
+      -- ports are still read while the MIR is held by a WAIT or a stall (the
+      -- jump target has to be valid at the clk5 that ends the wait)
+      PROC_CLK5_MPM: process (w_clk5)
+      begin
+        if rising_edge(w_clk5) then
+          if w_hold = '0' AND w_mmux_sel = "00" then
+            r_MIR <= r_MIR_NEXT;
+          elsif w_hold = '0' then
+            r_MIR <= r_MIR_TARGET;
+          end if;
+        end if;
+      end process PROC_CLK5_MPM;
+    end generate MPM_PREFETCH;
     
 
     -- load A- and B register
@@ -355,16 +726,32 @@ begin
     end process PROC_CLK2;    
     
     
-    -- load internal registers
+    -- RAM access not finished: the microinstruction is repeated (not for a
+    -- read of the queue)
+    PROC_CLK3: process (w_clk3)
+    begin
+      if rising_edge(w_clk3) then
+        r_MEM_STALL <= ((w_rd AND NOT(w_queue_rd)) OR w_wr) AND NOT(i_READY);
+        r_QUEUE_READY <= i_READY;
+      end if;
+    end process PROC_CLK3;
+    
+    
+    -- load internal registers (not for a stall)
     -- reset- and interrupt-pin (event) also synchronous to clock
     PROC_CLK4: process (w_clk4)
     begin
       if rising_edge(w_clk4) then
-        if (r_ENC_MIR = '1') then
+        if r_MEM_STALL = '1' then
+          null;
+        elsif (r_ENC_MIR = '1') then
            
           -- synthesis translate_off
-          -- no write operation to registers with constants allowed
-          assert(to_integer(UNSIGNED(r_C_MIR)) < 20)
+          -- no write operation to registers with constants allowed (ISEL and
+          -- ICTRL are registers of the interrupt controller)
+          assert( (to_integer(UNSIGNED(r_C_MIR)) < 20) OR
+                  (to_integer(UNSIGNED(r_C_MIR)) = 21) OR
+                  (to_integer(UNSIGNED(r_C_MIR)) = 22) )
           report("C-Bus-Error: Unallowed write! (microcode wrong)")
           severity failure;
           
@@ -385,27 +772,75 @@ begin
           -- As no write to registers 20-31 is allowed, synthesis removes this
           -- registers (constant values)
           if to_integer(UNSIGNED(r_C_MIR)) < 20 then
-            r_REGISTERS(to_integer(UNSIGNED(r_C_MIR))) <= w_alu_out;
+            if r_BANK = '1' AND c_banked(to_integer(UNSIGNED(r_C_MIR))) = '1'
+            then
+              r_SHADOW(to_integer(UNSIGNED(r_C_MIR))) <= w_alu_out;
+            else
+              r_REGISTERS(to_integer(UNSIGNED(r_C_MIR))) <= w_alu_out;
+            end if;
+          end if;
+        elsif w_pc_inc = '1' then
+          -- PC incrementer (PCH: register 6, PCL: register 7)
+          if r_BANK = '1' then
+            r_SHADOW(6) <= w_pc_plus(2*g_bit-1 downto g_bit);
+            r_SHADOW(7) <= w_pc_plus(g_bit-1 downto 0);
+          else
+            r_REGISTERS(6) <= w_pc_plus(2*g_bit-1 downto g_bit);
+            r_REGISTERS(7) <= w_pc_plus(g_bit-1 downto 0);
+          end if;
+        elsif w_bank_enter = '1' then
+          if r_BANK = '0' then
+            r_BANK <= '1';
+          else
+            r_NEST <= r_NEST + 1;
+          end if;
+        elsif w_bank_leave = '1' then
+          if r_BANK = '1' AND r_NEST = 0 then
+            r_BANK <= '0';
+          elsif r_BANK = '1' then
+            r_NEST <= r_NEST - 1;
+          end if;
+        elsif w_bank_clear = '1' then
+          r_BANK <= '0';
+          r_NEST <= (others => '0');
+        elsif w_sp_push = '1' then
+          -- SP unit (SPH: register 4, SPL: register 5)
+          r_REGISTERS(4) <= w_sp_minus(2*g_bit-1 downto g_bit);
+          r_REGISTERS(5) <= w_sp_minus(g_bit-1 downto 0);
+        elsif w_sp_pull = '1' then
+          r_REGISTERS(4) <= w_sp_plus(2*g_bit-1 downto g_bit);
+          r_REGISTERS(5) <= w_sp_plus(g_bit-1 downto 0);
+        end if;
+        if r_MEM_STALL = '0' then
+          r_BANK_SWITCH <= w_bank_switch;
+          if w_lock_cmd = '1' then
+            r_LOCK <= '1';
+          elsif w_wr = '1' then
+            r_LOCK <= '0';
           end if;
         end if;
         
-        -- additional possible load of the EVENT reister, depending on
-        -- the content of the EVENT register and the value of w_event_control
-        if (w_event_control /= c_no_event) AND 
-           ( to_integer(UNSIGNED(w_event_control)) < 
-             to_integer(UNSIGNED(r_REGISTERS(15))) ) then
-          r_REGISTERS(15) <= w_event_control;
+        -- EVENT register: a reset event is loaded at once, otherwise EVENT
+        -- follows the interrupt controller (the reset has to be served first 
+        -- and a write of the microcode has priority)
+        if w_int_reset = '1' then
+          r_REGISTERS(15) <= (others => '0');
+        elsif NOT(r_ENC_MIR = '1' AND to_integer(UNSIGNED(r_C_MIR)) = 15) AND
+              to_integer(UNSIGNED(r_REGISTERS(15))) /= 0 then
+          r_REGISTERS(15) <= w_int_event;
         end if;
               
        end if; 
     end process PROC_CLK4;
 
 
-    -- load MPC
+    -- load MPC (held by a WAIT or a stall)
     PROC_CLK5: process (w_clk5)
     begin
       if rising_edge(w_clk5) then
+        if w_hold = '0' then
           r_MPC <= w_mmux_to_mpc;
+        end if;
       end if;
     end process PROC_CLK5;
     
@@ -415,6 +850,17 @@ begin
   --
 
     -- synthesis translate_off
+    -- the opcode is the lower byte of the IR
+    assert (g_bit >= c_opcode_size)
+    report("Generic error: g_bit has to be at least 8!")
+    severity failure;
+    
+    assert (g_mpm_style = "BLOCK" OR g_mpm_style = "NANO" OR 
+            g_mpm_style = "LOGIC" OR g_mpm_style = "PREFETCH")
+    report("Generic error: g_mpm_style has to be BLOCK, NANO, LOGIC or " &
+           "PREFETCH!")
+    severity failure;
+    
     -- it is not possible to read from IR
     assert ( (to_integer(UNSIGNED(r_A_MIR)) /= 14) AND 
              (to_integer(UNSIGNED(r_B_MIR)) /= 14) )
@@ -422,19 +868,141 @@ begin
     severity failure;
     -- synthesis translate_on 
   
-    -- A- and B decoder (load A- and B-bus)
-    w_a_bus <= r_REGISTERS(to_integer(UNSIGNED(r_A_MIR)));
-    w_b_bus <= r_REGISTERS(to_integer(UNSIGNED(r_B_MIR)));  
+    -- A- and B decoder (load A- and B-bus), banked registers from the 
+    -- active bank, 21 to 23 from the interrupt controller
+    PROC_view: process (r_REGISTERS, r_SHADOW, r_BANK, w_int_sel, w_int_ctrl,
+        w_int_entry)
+    begin
+      for i in t_REG'range loop
+        if r_BANK = '1' AND c_banked(i) = '1' then
+          w_view(i) <= r_SHADOW(i);
+        else
+          w_view(i) <= r_REGISTERS(i);
+        end if;
+      end loop;
+      w_view(21) <= w_int_sel;
+      w_view(22) <= w_int_ctrl;
+      w_view(23) <= w_int_entry;
+    end process PROC_view;
+    
+    w_a_bus <= w_view(to_integer(UNSIGNED(r_A_MIR)));
+    w_b_bus <= w_view(to_integer(UNSIGNED(r_B_MIR)));
    
+    -- auxiliary command decoder
+    w_flag_sel <= '1' when (r_ENC_MIR = '0' AND r_C_MIR = c_aux_sel_cv) 
+                  else '0';
+    w_pc_inc <= '1' when (r_ENC_MIR = '0' AND r_C_MIR = c_aux_pc_inc) 
+                else '0';
+    
+    w_sp_push <= '1' when (r_ENC_MIR = '0' AND r_C_MIR = c_aux_sp_push) 
+                 else '0';
+    w_sp_pull <= '1' when (r_ENC_MIR = '0' AND r_C_MIR = c_aux_sp_pull) 
+                 else '0';
+    
+    w_bank_enter <= '1' when (r_ENC_MIR = '0' AND r_C_MIR = c_aux_bank_enter)
+                    else '0';
+    w_bank_leave <= '1' when (r_ENC_MIR = '0' AND r_C_MIR = c_aux_bank_leave)
+                    else '0';
+    w_bank_clear <= '1' when (r_ENC_MIR = '0' AND r_C_MIR = c_aux_bank_clear)
+                    else '0';
+    
+    -- WAIT: EVENT is loaded at clk4, so the MPC (clk5) and the MIR (clk1) 
+    -- see the same value; the phase clocks keep running (the EVENT register
+    -- and the interrupt controller need clk4), the held registers are only
+    -- not enabled
+    w_wait <= '1' when (r_ENC_MIR = '0' AND r_C_MIR = c_aux_wait AND 
+                        r_REGISTERS(15) = c_no_event) else '0';
+    
+    -- a stall (r_MEM_STALL, loaded at clk3) holds the MIR and the MPC like a
+    -- WAIT, the registers loaded at clk4 are not enabled (w_exec), so the 
+    -- repeated microinstruction sees the same registers and flags
+    w_hold <= w_wait OR r_MEM_STALL;
+    w_exec <= NOT(r_MEM_STALL);
+    
+    w_lock_cmd <= '1' when (r_ENC_MIR = '0' AND r_C_MIR = c_aux_lock) 
+                  else '0';
+    
+    -- bank switch of ENTER (bank 0 used) and LEAVE (no nested interrupt),
+    -- registered at clk4 like the flags, replaces Z and N (not Z) for the 
+    -- jump condition
+    w_bank_switch <= NOT(r_BANK) when w_bank_enter = '1' else
+                     r_BANK when (w_bank_leave = '1' AND r_NEST = 0) else
+                     '0';
+    w_seq_z <= r_BANK_SWITCH when (w_bank_enter = '1' OR w_bank_leave = '1')
+               else w_alu_z;
+    w_seq_n <= NOT(r_BANK_SWITCH) 
+                 when (w_bank_enter = '1' OR w_bank_leave = '1')
+               else w_alu_n;
+    
+    -- interrupt controller: a reset event resets it, writes of ISEL (21) and
+    -- ICTRL (22), the write of EVENT acknowledges the event in Z (register
+    -- 19); the level is the one of the CC after clk4 (the CC that is written
+    -- or the CC of the bank that is active after a bank command), so the 
+    -- EVENT register is loaded according to the new level
+    w_int_reset <= '1' when UNSIGNED(w_event_control) = 0 else '0';
+    w_int_wr_sel <= '1' when (r_ENC_MIR = '1' AND r_MEM_STALL = '0' AND
+                              to_integer(UNSIGNED(r_C_MIR)) = 21) else '0';
+    w_int_wr_ctrl <= '1' when (r_ENC_MIR = '1' AND r_MEM_STALL = '0' AND
+                               to_integer(UNSIGNED(r_C_MIR)) = 22) else '0';
+    w_int_ack <= '1' when (r_ENC_MIR = '1' AND r_MEM_STALL = '0' AND
+                           to_integer(UNSIGNED(r_C_MIR)) = 15) else '0';
+    
+    w_bank_next <= '1' when w_bank_enter = '1' else
+                   '0' when ((w_bank_leave = '1' AND r_NEST = 0) OR 
+                             w_bank_clear = '1') else
+                   r_BANK;
+    w_int_level <= w_alu_out(7 downto 5) 
+                     when (r_ENC_MIR = '1' AND 
+                           to_integer(UNSIGNED(r_C_MIR)) = 9) else
+                   r_SHADOW(9)(7 downto 5) when w_bank_next = '1' else
+                   r_REGISTERS(9)(7 downto 5);
+    
+    -- 16 bit PC incrementer (PC of the active bank)
+    w_pc <= r_SHADOW(6) & r_SHADOW(7) when r_BANK = '1' else
+            r_REGISTERS(6) & r_REGISTERS(7);
+    w_pc_plus <= STD_LOGIC_VECTOR(UNSIGNED(w_pc) + 1);
+    
+    -- 16 bit SP unit: the SP is stable until clk4, so the MAR (clk3) takes 
+    -- the address from the SP unit instead of the A- and B-latch
+    w_sp_minus <= STD_LOGIC_VECTOR(
+                    UNSIGNED(r_REGISTERS(4) & r_REGISTERS(5)) - 1);
+    w_sp_plus <= STD_LOGIC_VECTOR(
+                   UNSIGNED(r_REGISTERS(4) & r_REGISTERS(5)) + 1);
+    w_mar_a <= w_sp_minus(g_bit-1 downto 0) when w_sp_push = '1' else
+               r_REGISTERS(5) when w_sp_pull = '1' else
+               r_A_REG;
+    w_mar_b <= w_sp_minus(2*g_bit-1 downto g_bit) when w_sp_push = '1' else
+               r_REGISTERS(4) when w_sp_pull = '1' else
+               r_B_REG;
+  
     -- instruction decoder
-    w_instruct <= r_REGISTERS(14)(7 downto 0)  & "0000";
+    w_instruct <= r_REGISTERS(14)(c_opcode_size-1 downto 0) & "0000";
     
     w_mpc_plus <= STD_LOGIC_VECTOR(UNSIGNED(r_MPC) + 1);
   
     -- outputs
-    o_RD <= r_RD_MIR;
-    o_WR <= r_WR_MIR;
-    o_CLK_MEMORY <= w_clk1;
+    -- RAM is clocked at clk3: a take uses the address of the A- and B-latch 
+    -- (clk2) and loads the MBR at clk4
+    -- only the steps that use the RAM drive RD and WR (like 
+    -- "Processor_Pipelined"): MBR <- M[MAR] (1010) and take (1110) read, 
+    -- M[MAR] <- MBR (0001) writes; no RAM access for the MAR loads (0110, 
+    -- 0100), MBR <- ALU (1001) and the MAR steps (MAR <- MAR + 1: 0010, 
+    -- MAR <- MAR - 1: 0011)
+    w_rd <= (r_RD_MIR AND r_MBR_MIR AND NOT(w_queue_hit)) OR w_queue_rd;
+    w_wr <= r_WR_MIR AND NOT(r_RD_MIR) AND NOT(r_MBR_MIR);
+    o_RD <= w_rd;
+    o_WR <= w_wr;
+    -- o_ADDRESS and o_QUEUE_RD change in the same delta cycle
+    o_ADDRESS <= w_address;
+    o_QUEUE_RD <= w_queue_rd;
+    o_LOCK <= r_LOCK OR w_lock_cmd;
+    o_CLK_MEMORY <= w_clk3;
     o_CLK_MAIN <= w_main_clk;
     
+    -- profiling: valid for the microinstruction in the MIR (a decode that 
+    -- waits for the RAM is sampled at clk3 before r_MEM_STALL is set, the 
+    -- repetitions are not counted)
+    o_RETIRE <= '1' when (w_mmux_sel = "01" AND r_MEM_STALL = '0') else '0';
+    o_INT_TAKEN <= w_int_taken;
+    
 end Mixed;
\ No newline at end of file
@@ -33,7 +33,8 @@
 -- PROCESSOR CONTROLLER
 ----------------------------------------------------------------------------------
 -- included part(s): 
---    PROCESSOR, SEVEN SEGMENT CONTROL (SEGMENT DRIVER and  SEVEN SEGMENT) 
+--    PROCESSOR, TIMER, DMA, PERFORMANCE COUNTER, MEMORY ARBITER, SEVEN 
+--    SEGMENT CONTROL (SEGMENT DRIVER and SEVEN SEGMENT) 
 ----------------------------------------------------------------------------------
 -- Used for hardware implementation. It directly includes the RAM (which is
 -- actually intended to be externally).
@@ -41,6 +42,29 @@
 -- external switches the RAM can be addressed, and using two 7-segment displays 
 -- its memory content at this memory location is displayed in hexadecimal number
 -- format.
+-- The "Timer" is mapped to g_timer_address (6 registers) and requests 
+-- interrupt line 3, the "DMA" is mapped to g_dma_address (7 registers) and 
+-- requests interrupt line 4 (lines 1 and 2 are the buttons). Therefore the 
+-- vector table of the program needs 24 bytes. The RAM is not written at the
+-- registers. Only the lower g_ram_bit_size address bits are connected to the
+-- RAM (it is mirrored in the 64 KB address space), the registers are decoded
+-- from the complete address, so they hide RAM bytes only for a 16 bit RAM 
+-- (the register blocks must not overlap). The DMA copies in the memory 
+-- cycles in which the processor does not access the RAM (the address of the
+-- RAM port is then the one of the DMA). Every write of the RAM bus and of the
+-- DMA is snooped by the prefetch queues of the processors.
+-- The "Performance_Counter" is mapped to g_perf_address (21 registers) and 
+-- counts the cycles, instructions, finished RAM reads and writes and taken 
+-- interrupts of the first processor, so a program can be profiled with the 
+-- real button interrupts (e.g. the counters are stored in the RAM and shown
+-- on the display).
+-- With g_dual_core a second processor (no interrupt lines) shares the RAM, the
+-- timer and the DMA with the first one through the "Memory_Arbiter" 
+-- (g_arbiter_policy). It starts at the RESET vector at g_reset_vector_1 
+-- (behind the vector table of the first processor), so the program gives each
+-- processor its own main routine. Both processors are clocked by the same 
+-- input clock (their clock generators are identical), the clock of the RAM is
+-- the one of the first processor.
 ----------------------------------------------------------------------------------
 
 library IEEE;
@@ -65,7 +89,18 @@ entity Processor_Controller is
       g_debounce_counter_bit_size : positive := 20;
       -- used for displaying the digits of the seven segment displays alternating.
       -- for 10 MHz clock 15 bit optimal
-      g_LED_counter_bit_size : positive := 15 
+      g_LED_counter_bit_size : positive := 15;
+      -- first register of the timer
+      g_timer_address : natural := 16#FE00#;
+      -- first register of the DMA
+      g_dma_address : natural := 16#FE08#;
+      -- first register of the performance counter
+      g_perf_address : natural := 16#FE10#;
+      -- second processor sharing the RAM ("ROUND_ROBIN" or "FIXED", see 
+      -- "Memory_Arbiter")
+      g_dual_core : boolean := FALSE;
+      g_arbiter_policy : string := "ROUND_ROBIN";
+      g_reset_vector_1 : natural := 16#0018#
     );
     Port ( 
       i_CLK : in STD_LOGIC;
@@ -83,14 +118,59 @@ end Processor_Controller;
 
 architecture Mixed of Processor_Controller is
 
+    -- RAM bus (processor 0 or the processor that got the RAM)
     signal w_address : STD_LOGIC_VECTOR (15 downto 0);
     signal w_rd : STD_LOGIC;
     signal w_wr : STD_LOGIC;
+    signal w_write_data : STD_LOGIC_VECTOR (7 downto 0);
+    signal w_read_data : STD_LOGIC_VECTOR (7 downto 0);
     signal w_clk_memory : STD_LOGIC;
     signal w_main_clk : STD_LOGIC;
+    signal w_interrupt : STD_LOGIC_VECTOR (1 to 4);
+    
+    -- processor 0
+    signal w_address_0 : STD_LOGIC_VECTOR (15 downto 0);
+    signal w_rd_0 : STD_LOGIC;
+    signal w_wr_0 : STD_LOGIC;
+    signal w_lock_0 : STD_LOGIC;
+    signal w_ready_0 : STD_LOGIC;
+    signal w_retire_0 : STD_LOGIC;
+    signal w_int_taken_0 : STD_LOGIC;
     
     signal r_DATA : STD_LOGIC_VECTOR (7 downto 0) := (others => '0');
     signal rw_DATA_LINE : STD_LOGIC_VECTOR (7 downto 0) := (others => 'Z');
+    
+    signal w_timer_data : STD_LOGIC_VECTOR (7 downto 0);
+    signal w_timer_selected : STD_LOGIC;
+    signal w_timer_interrupt : STD_LOGIC;
+    
+    signal w_dma_data : STD_LOGIC_VECTOR (7 downto 0);
+    signal w_dma_selected : STD_LOGIC;
+    signal w_dma_interrupt : STD_LOGIC;
+    signal w_dma_ram_address : STD_LOGIC_VECTOR (15 downto 0);
+    signal w_dma_ram_data : STD_LOGIC_VECTOR (7 downto 0);
+    signal w_dma_ram_enable : STD_LOGIC;
+    signal w_dma_ram_write : STD_LOGIC;
+    
+    signal w_perf_data : STD_LOGIC_VECTOR (7 downto 0);
+    signal w_perf_selected : STD_LOGIC;
+    
+    -- address of the RAM port (processor or DMA)
+    signal w_ram_address : STD_LOGIC_VECTOR (15 downto 0);
+    
+    -- write of the RAM bus or the DMA (clears the prefetch queues)
+    signal w_snoop_wr : STD_LOGIC;
+    signal w_snoop_address : STD_LOGIC_VECTOR (15 downto 0);
+    
+    -- RAM indices (lower g_ram_bit_size bits of the addresses)
+    alias w_ram_index : STD_LOGIC_VECTOR (g_ram_bit_size-1 downto 0) is
+        w_ram_address(g_ram_bit_size-1 downto 0);
+    alias w_write_index : STD_LOGIC_VECTOR (g_ram_bit_size-1 downto 0) is
+        w_address(g_ram_bit_size-1 downto 0);
+    alias w_segment_index : STD_LOGIC_VECTOR (g_ram_bit_size-1 downto 0) is
+        i_SEGMENT_ADDRESS(g_ram_bit_size-1 downto 0);
+    alias w_dma_ram_index : STD_LOGIC_VECTOR (g_ram_bit_size-1 downto 0) is
+        w_dma_ram_address(g_ram_bit_size-1 downto 0);
 
     -- stores content that should be displayed on the 7-segment display
     signal r_DISPLAY_DATA : STD_LOGIC_VECTOR (7 downto 0) := (others => '0');
@@ -98,29 +178,190 @@ architecture Mixed of Processor_Controller is
     signal w_digit : STD_LOGIC_VECTOR (3 downto 0);
 
     signal r_RAM : t_RAM (0 to 2**g_ram_bit_size-1) := 
-        initRam("..\..\..\RAM_File\" & g_ram_filename, 2**g_ram_bit_size-1);
+        initRam("..\..\..\RAM_File\" & g_ram_filename, 2**g_ram_bit_size-1, 8);
         
     attribute ram_style : string;   
     attribute ram_style of r_RAM : signal is "block";
     
 begin
 
+    -- synthesis translate_off
+    -- register blocks: timer 6, DMA 7 and performance counter 21 registers
+    assert (g_timer_address + 6 <= g_dma_address OR 
+            g_dma_address + 7 <= g_timer_address) AND
+           (g_timer_address + 6 <= g_perf_address OR 
+            g_perf_address + 21 <= g_timer_address) AND
+           (g_dma_address + 7 <= g_perf_address OR 
+            g_perf_address + 21 <= g_dma_address) AND
+           (g_timer_address + 6 <= 2**16) AND (g_dma_address + 7 <= 2**16) AND
+           (g_perf_address + 21 <= 2**16)
+    report("Generic error: the registers of the timer, DMA and performance " &
+           "counter overlap or exceed the 16 bit address space!")
+    severity failure;
+    -- synthesis translate_on
+
     Processor_inst : entity work.Processor
       generic map (
+        g_interrupt_line_size => 4,
+        g_direct_interrupt_lines => 2,
         g_debounce_counter_bit_size => g_debounce_counter_bit_size 
       )
       port map ( 
         i_CLK => i_CLK,
         i_RESET_PIN => i_RESET, 
-        i_INTERRUPT => i_INTERRUPT,
-        o_ADDRESS => w_address,
-        o_RD => w_rd,
-        o_WR => w_wr,
+        i_INTERRUPT => w_interrupt,
+        o_ADDRESS => w_address_0,
+        o_RD => w_rd_0,
+        o_WR => w_wr_0,
+        i_READY => w_ready_0,
+        o_LOCK => w_lock_0,
+        o_RETIRE => w_retire_0,
+        o_INT_TAKEN => w_int_taken_0,
+        i_SNOOP_WR => w_snoop_wr,
+        i_SNOOP_ADDRESS => w_snoop_address,
         io_DATA => rw_DATA_LINE, 
         o_CLK_MEMORY => w_clk_memory,
         o_CLK_MAIN => w_main_clk
       );
       
+    w_interrupt <= i_INTERRUPT & w_timer_interrupt & w_dma_interrupt;
+    
+    
+    SINGLE_CORE: if NOT(g_dual_core) generate
+      w_address <= w_address_0;
+      w_rd <= w_rd_0;
+      w_wr <= w_wr_0;
+      w_write_data <= rw_DATA_LINE;
+      w_ready_0 <= '1';
+    end generate SINGLE_CORE;
+    
+    
+    DUAL_CORE: if g_dual_core generate
+      signal w_address_1 : STD_LOGIC_VECTOR (15 downto 0);
+      signal w_rd_1 : STD_LOGIC;
+      signal w_wr_1 : STD_LOGIC;
+      signal w_lock_1 : STD_LOGIC;
+      signal w_ready_1 : STD_LOGIC;
+      signal w_grant : STD_LOGIC;
+      signal w_no_interrupt : STD_LOGIC_VECTOR (1 to 1);
+      signal rw_DATA_LINE_1 : STD_LOGIC_VECTOR (7 downto 0) 
+          := (others => 'Z');
+    begin
+      w_no_interrupt <= "0";
+    
+      Processor_inst_1 : entity work.Processor
+        generic map (
+          g_interrupt_line_size => 1,
+          g_debounce_counter_bit_size => g_debounce_counter_bit_size 
+        )
+        port map ( 
+          i_CLK => i_CLK,
+          i_RESET_PIN => i_RESET, 
+          i_INTERRUPT => w_no_interrupt,
+          o_ADDRESS => w_address_1,
+          o_RD => w_rd_1,
+          o_WR => w_wr_1,
+          i_READY => w_ready_1,
+          o_LOCK => w_lock_1,
+          o_RETIRE => open,
+          o_INT_TAKEN => open,
+          i_SNOOP_WR => w_snoop_wr,
+          i_SNOOP_ADDRESS => w_snoop_address,
+          io_DATA => rw_DATA_LINE_1, 
+          o_CLK_MEMORY => open,
+          o_CLK_MAIN => open
+        );
+        
+      Memory_Arbiter_inst : entity work.Memory_Arbiter
+        generic map (
+          g_bit => 8,
+          g_policy => g_arbiter_policy,
+          g_reset_vector_1 => g_reset_vector_1
+        )
+        port map ( 
+          i_CLK => w_clk_memory,
+          i_ADDRESS_0 => w_address_0,
+          i_RD_0 => w_rd_0,
+          i_WR_0 => w_wr_0,
+          i_LOCK_0 => w_lock_0,
+          o_READY_0 => w_ready_0,
+          i_ADDRESS_1 => w_address_1,
+          i_RD_1 => w_rd_1,
+          i_WR_1 => w_wr_1,
+          i_LOCK_1 => w_lock_1,
+          o_READY_1 => w_ready_1,
+          o_ADDRESS => w_address,
+          o_RD => w_rd,
+          o_WR => w_wr,
+          o_GRANT => w_grant
+        );
+        
+      w_write_data <= rw_DATA_LINE_1 when w_grant = '1' else rw_DATA_LINE;
+      -- the processor that did not get the RAM repeats its read
+      rw_DATA_LINE_1 <= w_read_data when w_rd_1 = '1' else (others => 'Z');
+    end generate DUAL_CORE;
+    
+      
+    Timer_inst : entity work.Timer
+      generic map (
+        g_bit => 8,
+        g_base_address => g_timer_address
+      )
+      port map ( 
+        i_CLK => w_clk_memory,
+        i_ADDRESS => w_address,
+        i_DATA => w_write_data,
+        i_WR => w_wr,
+        o_DATA => w_timer_data,
+        o_SELECTED => w_timer_selected,
+        o_INTERRUPT => w_timer_interrupt
+      );
+      
+    DMA_inst : entity work.DMA
+      generic map (
+        g_bit => 8,
+        g_base_address => g_dma_address
+      )
+      port map ( 
+        i_CLK => w_clk_memory,
+        i_ADDRESS => w_address,
+        i_DATA => w_write_data,
+        i_RD => w_rd,
+        i_WR => w_wr,
+        o_DATA => w_dma_data,
+        o_SELECTED => w_dma_selected,
+        i_RAM_DATA => r_DATA,
+        o_RAM_ADDRESS => w_dma_ram_address,
+        o_RAM_DATA => w_dma_ram_data,
+        o_RAM_ENABLE => w_dma_ram_enable,
+        o_RAM_WRITE => w_dma_ram_write,
+        o_INTERRUPT => w_dma_interrupt
+      );
+      
+    Performance_Counter_inst : entity work.Performance_Counter
+      generic map (
+        g_bit => 8,
+        g_base_address => g_perf_address
+      )
+      port map ( 
+        i_CLK => w_clk_memory,
+        i_ADDRESS => w_address,
+        i_DATA => w_write_data,
+        i_WR => w_wr,
+        o_DATA => w_perf_data,
+        o_SELECTED => w_perf_selected,
+        i_RETIRE => w_retire_0,
+        i_PROC_RD => w_rd_0,
+        i_PROC_WR => w_wr_0,
+        i_PROC_READY => w_ready_0,
+        i_INT_TAKEN => w_int_taken_0,
+        o_CYCLES => open,
+        o_INSTRUCTIONS => open,
+        o_READS => open,
+        o_WRITES => open,
+        o_INTERRUPTS => open
+      );
+      
     Segment_Driver : entity work.Segment_Driver
       generic map (
         g_counter_bit_size => g_LED_counter_bit_size
@@ -144,27 +385,57 @@ begin
       ); 
 
 
+    w_ram_address <= w_dma_ram_address when w_dma_ram_enable = '1' else 
+                     w_address;
+    
+    -- the DMA only writes in cycles without access of the processors
+    w_snoop_wr <= w_wr OR w_dma_ram_write;
+    w_snoop_address <= w_dma_ram_address when w_dma_ram_write = '1' else
+                       w_address;
+    
+    -- synthesis translate_off
+    -- the blocks of the DMA must stay inside the RAM (no mirror, no registers)
+    PROC_dma_check: process (w_clk_memory)
+    begin
+      if rising_edge(w_clk_memory) then
+        assert (w_dma_ram_enable = '0' OR 
+                to_integer(unsigned(w_dma_ram_address)) < 2**g_ram_bit_size)
+        report("DMA error: copy address outside the RAM!")
+        severity error;
+      end if;
+    end process PROC_dma_check;
+    -- synthesis translate_on
+
     PROC_memory_processor: process (w_clk_memory)
     begin
       if rising_edge(w_clk_memory) then
-        if w_wr = '1' then
-          r_RAM(to_integer(unsigned(w_address))) <= rw_DATA_LINE;    
+        if w_wr = '1' AND w_timer_selected = '0' AND w_dma_selected = '0' AND
+           w_perf_selected = '0' then
+          r_RAM(to_integer(unsigned(w_write_index)))(7 downto 0) <= 
+              w_write_data;
+        elsif w_dma_ram_write = '1' then
+          r_RAM(to_integer(unsigned(w_dma_ram_index)))(7 downto 0) <= 
+              w_dma_ram_data;
         end if;
         -- output updated at every rising edge
         -- no problem, as data by processor only used when needed
-        r_DATA <= r_RAM(to_integer(unsigned((w_address))));    
+        r_DATA <= r_RAM(to_integer(unsigned(w_ram_index)))(7 downto 0);
       end if;
     end process PROC_memory_processor; 
     
     
-    rw_DATA_LINE <= r_DATA when w_rd = '1' else (others => 'Z');    
+    w_read_data <= w_timer_data when w_timer_selected = '1' else
+                   w_dma_data when w_dma_selected = '1' else
+                   w_perf_data when w_perf_selected = '1' else
+                   r_DATA;
+    rw_DATA_LINE <= w_read_data when w_rd_0 = '1' else (others => 'Z');    
     
     
     PROC_memory_LED: process (w_clk_memory)
     begin
       if rising_edge(w_clk_memory) then
         r_DISPLAY_DATA <= 
-            r_RAM(to_integer(unsigned(i_SEGMENT_ADDRESS)));
+            r_RAM(to_integer(unsigned(w_segment_index)))(7 downto 0);
       end if;
     end process PROC_memory_LED; 
 
@@ -0,0 +1,877 @@
+-- BSD 3-Clause License
+-- 
+-- Copyright (c) 2018, Bernhard Vacarescu
+-- All rights reserved.
+-- 
+-- Redistribution and use in source and binary forms, with or without
+-- modification, are permitted provided that the following conditions are met:
+-- 
+-- * Redistributions of source code must retain the above copyright notice, this
+--   list of conditions and the following disclaimer.
+-- 
+-- * Redistributions in binary form must reproduce the above copyright notice,
+--   this list of conditions and the following disclaimer in the documentation
+--   and/or other materials provided with the distribution.
+-- 
+-- * Neither the name of the copyright holder nor the names of its
+--   contributors may be used to endorse or promote products derived from
+--   this software without specific prior written permission.
+-- 
+-- THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+-- AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+-- IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+-- DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+-- FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+-- DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+-- SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+-- CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+-- OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+-- OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------------------
+-- PROCESSOR PIPELINED (single clock)
+----------------------------------------------------------------------------------
+-- included part(s): 
+--    ALU, MBR, MICROSEQUENCER, MUX (MMux and AMux), EVENT CONTROLLER,
+--    INTERRUPT CONTROLLER
+----------------------------------------------------------------------------------
+-- Executes the same microcode as the module "Processor" (same ports, same 
+-- results), but every register is loaded at the rising edge of one clock 
+-- (i_CLK) instead of five phase clocks. A microinstruction passes three 
+-- stages, so up to one microinstruction is finished per clock:
+--    F: the MPM is read at the next MPC (BLOCK: synchronous block ROM)
+--    D: MIR valid, the A- and B-bus are read into the A- and B-latch and 
+--       unconditional sequencing (MPC + 1, jump, call, return) is decided
+--    X: ALU, MAR, MBR and C-bus are loaded, the ALU flags are registered
+-- Hazards:
+--    - a register written by the microinstruction in X is forwarded from the
+--      ALU output to the A- or B-latch (the C-bus write is done at the same
+--      clock edge), PCH and PCL from the PC incrementer, SPH and SPL from
+--      the SP unit, the operands are read from the register bank that is 
+--      active after the microinstruction in X, EVENT is forwarded with the
+--      value it has after the clock edge (the interrupt controller is 
+--      updated every clock)
+--    - a conditional jump and the dispatch (MPC <- f(IR)) are decided in X 
+--      with the new flags (the new IR) of the microinstruction itself, the 
+--      next microinstruction is fetched one clock later (one empty cycle)
+-- Memory: o_CLK_MEMORY is the inverted clock, so a synchronous RAM reads or
+-- writes in the middle of the cycle. o_RD is only set for the second step of
+-- a read (MBR <- M[MAR]), for a take that is not served by the prefetch queue
+-- and for the reads of the queue (o_QUEUE_RD). o_WR is only set for the third
+-- step of a write (M[MAR] <- MBR), as the MAR (MBR) is loaded at the end of 
+-- the step before.
+-- The MAR steps (MAR <- MAR + 1, MAR <- MAR - 1) do not access the RAM.
+-- WAIT (WAI): the microinstruction is held in stage D (stage X empty, no 
+-- fetch) as long as EVENT after the clock edge is "no event".
+-- i_READY is sampled at the rising edge of i_CLK: if the RAM access of stage X
+-- is not finished, all stages are held (no register, flag, MBR or queue is 
+-- loaded, the EVENT register and the interrupt controller still follow the
+-- requests) and the access is repeated in the next clock. A read of the 
+-- prefetch queue does not hold the stages: without i_READY the byte is 
+-- dropped and read again in a later clock.
+-- For profiling (see "Performance_Counter") o_RETIRE is set in the clock in
+-- which the dispatch (MPC <- f(IR)) is in stage X and o_INT_TAKEN in the one
+-- in which stage X enters the routine of an interrupt line (write of EVENT).
+-- ICTRL and IENTRY are not forwarded, the microcode must not read them in the
+-- microinstruction after a write of ISEL, ICTRL or Z.
+-- The microcode must not use a conditional jump or the dispatch in the first
+-- step of a read or the first two steps of a write (the empty cycle would
+-- break the sequence that is checked by the "Communication" module).
+-- Only the MPM styles "BLOCK" and "LOGIC" are supported.
+----------------------------------------------------------------------------------
+
+library IEEE;
+use IEEE.STD_LOGIC_1164.ALL;
+use IEEE.NUMERIC_STD.ALL;
+
+use STD.TEXTIO.ALL;
+use ieee.std_logic_textio.all;
+
+library work;
+use work.datatypes.all;
+use work.functions.all;
+
+-- generics: see module "Processor" (i_CLK is used directly as clock, so
+-- g_debounce_counter_bit_size has to fit to its frequency)
+
+entity Processor_Pipelined is
+    Generic( 
+      g_bit : positive := 8;
+      g_interrupt_line_size : positive := 2;
+      g_direct_interrupt_lines : natural := 0;
+      g_debounce_counter_bit_size : positive := 20; 
+      g_mpm_style : string := "BLOCK";
+      g_micro_stack_depth : positive := 4;
+      g_adder_style : string := "RIPPLE";
+      g_queue_depth : natural := 4;
+      g_dec_sel_size : positive := 5;
+      g_mmux_bus_size : positive := 12;
+      g_mmux_sel_size : positive := 2;
+      g_amux_sel_size : positive := 1
+    ); 
+    Port ( 
+      i_CLK : in STD_LOGIC;
+      i_RESET_PIN : in STD_LOGIC; 
+      i_INTERRUPT: in STD_LOGIC_VECTOR (1 to g_interrupt_line_size);
+      o_ADDRESS : out STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+      o_RD : out STD_LOGIC;
+      o_WR : out STD_LOGIC;
+      o_QUEUE_RD : out STD_LOGIC;  -- o_RD is a read of the prefetch queue
+      i_READY : in STD_LOGIC := '1';  -- RAM access of stage X done
+      o_RETIRE : out STD_LOGIC;  -- instruction decoded
+      o_INT_TAKEN : out STD_LOGIC;  -- routine of an interrupt line entered
+      i_SNOOP_WR : in STD_LOGIC := '0';  -- RAM write of any master
+      i_SNOOP_ADDRESS : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0) 
+          := (others => '0');
+      o_CLK_MEMORY : out STD_LOGIC;  -- clock for RAM operations
+      o_CLK_MAIN : out STD_LOGIC;  -- clock of the processor (i_CLK)
+      io_DATA : inout STD_LOGIC_VECTOR (g_bit-1 downto 0)  -- connection to RAM
+    );
+end Processor_Pipelined;
+
+
+
+architecture Mixed of Processor_Pipelined is
+    
+    -- output of the event controller (reset event) and of the interrupt 
+    -- controller, which is loaded into the EVENT register
+    signal w_event_control : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_int_pulse : STD_LOGIC_VECTOR (1 to g_interrupt_line_size);
+    signal w_int_event : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    
+    -- type for internal registers
+    type t_REG is array (0 to 2**g_dec_sel_size-1) 
+        of STD_LOGIC_VECTOR (g_bit-1 downto 0);
+  
+    -- initialisation of the 32 8-bit registers
+    signal r_REGISTERS : t_REG := (
+      4 => (others => '1'), -- SPH
+      5 => (others => '1'), -- SPL
+      6 => (others => '0'), -- PCH
+      7 => (others => '0'), -- PCL 
+      9 => (4 => '1', others => '0'), -- CC (interrupts disabled)
+     15 => (g_bit-1 => '1', others => '0'), -- EVENT (no event status)
+     -- CONSTANT REGISTERS (removed as registers at synthesis)
+     20 => (g_bit-1 => '1', others => '0'), -- no event status
+     -- 21 to 23: ISEL, ICTRL, IENTRY (interrupt controller)
+     24 => STD_LOGIC_VECTOR(to_signed(-2, g_bit)),  -- -2 / 254
+     25 => STD_LOGIC_VECTOR(to_signed(-1, g_bit)),  -- -1 / 255
+     26 => STD_LOGIC_VECTOR(to_unsigned(16, g_bit)),-- 16
+     27 => STD_LOGIC_VECTOR(to_unsigned(8, g_bit)), -- 8
+     28 => STD_LOGIC_VECTOR(to_unsigned(4, g_bit)), -- 4
+     29 => STD_LOGIC_VECTOR(to_unsigned(2, g_bit)), -- 2
+     30 => STD_LOGIC_VECTOR(to_unsigned(1, g_bit)), -- 1
+     31 => (others => '0'),                         -- 0
+      others => (others => '0')
+    );
+    
+    -- second bank of the general registers (interrupt context), see module
+    -- "Processor"
+    signal r_SHADOW : t_REG := (
+      9 => (4 => '1', others => '0'), -- CC (interrupts disabled)
+      others => (others => '0')
+    );
+    
+    -- YRH, YRL, XRH, XRL, PCH, PCL, AC, CC, DH and DL are banked
+    constant c_banked : STD_LOGIC_VECTOR (0 to 2**g_dec_sel_size-1) := 
+        (0 to 3 => '1', 6 to 9 => '1', 16 to 17 => '1', others => '0');
+    
+    signal r_BANK : STD_LOGIC := '0';
+    signal r_NEST : UNSIGNED (2*g_bit-1 downto 0) := (others => '0');
+    
+    -- registers as seen by stage D (bank that is active after stage X, 
+    -- registers of the interrupt controller)
+    signal w_view : t_REG;
+    
+    attribute rom_style : string;   
+       
+  -------------------------------------------------------------------------------- 
+  -- pipeline registers
+  --
+  
+    -- empty microinstruction (no operation, flags unchanged)
+    constant c_nop_mir : STD_LOGIC_VECTOR (39 downto 0) 
+        := "0000111100000111111111111111000000000000";
+  
+    -- stage D: MIR and its MPM address
+    -- initial value: jump to address 0x000 in MPM
+    signal r_MIR : STD_LOGIC_VECTOR (39 downto 0) 
+        := "0011111100000111111111111111000000000000";
+    signal r_MIR_VALID : STD_LOGIC := '1';
+    signal r_MPC : STD_LOGIC_VECTOR (g_mmux_bus_size-1 downto 0) 
+        := (others => '0');
+    
+    -- stage X: microinstruction, its MPM address and the A- and B-latch
+    signal r_MIR_X : STD_LOGIC_VECTOR (39 downto 0) := c_nop_mir;
+    signal r_MPC_X : STD_LOGIC_VECTOR (g_mmux_bus_size-1 downto 0) 
+        := (others => '0');
+    signal r_A_REG : STD_LOGIC_VECTOR (g_bit-1 downto 0) := (others => '0');
+    signal r_B_REG : STD_LOGIC_VECTOR (g_bit-1 downto 0) := (others => '0');
+    
+    -- MIR of stage D (empty microinstruction if not valid)
+    signal w_mir_d : STD_LOGIC_VECTOR (39 downto 0);
+   
+    alias w_OP_D : STD_LOGIC is w_mir_d(39);
+    alias w_COND_D : STD_LOGIC_VECTOR is w_mir_d(37 downto 36);
+    alias w_ENC_D : STD_LOGIC is w_mir_d(27);
+    alias w_C_D : STD_LOGIC_VECTOR is w_mir_d(26 downto 22);
+    alias w_B_D : STD_LOGIC_VECTOR is w_mir_d(21 downto 17);
+    alias w_A_D : STD_LOGIC_VECTOR is w_mir_d(16 downto 12);
+    alias w_ADDRESS_D : STD_LOGIC_VECTOR is w_mir_d(g_mmux_bus_size-1 downto 0);
+    
+    alias r_OP_X : STD_LOGIC is r_MIR_X(39);
+    alias r_AMUX_X : STD_LOGIC is r_MIR_X(38);
+    alias r_COND_X : STD_LOGIC_VECTOR is r_MIR_X(37 downto 36);
+    alias r_ALU_X : STD_LOGIC_VECTOR is r_MIR_X(35 downto 32);
+    alias r_COMMUNICATION_X : STD_LOGIC_VECTOR is r_MIR_X(31 downto 28);
+    alias r_MBR_X : STD_LOGIC is r_MIR_X(31);
+    alias r_RD_X : STD_LOGIC is r_MIR_X(29);
+    alias r_WR_X : STD_LOGIC is r_MIR_X(28);
+    alias r_ENC_X : STD_LOGIC is r_MIR_X(27);
+    alias r_C_X : STD_LOGIC_VECTOR is r_MIR_X(26 downto 22);
+    alias r_ADDRESS_X : STD_LOGIC_VECTOR is r_MIR_X(g_mmux_bus_size-1 downto 0);
+    
+    
+  -------------------------------------------------------------------------------- 
+  -- connection lines
+  --
+  
+    signal w_a_bus : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_b_bus : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+       
+    signal w_alu_a : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_alu_z : STD_LOGIC;
+    signal w_alu_n : STD_LOGIC;
+    signal w_alu_c : STD_LOGIC;
+    signal w_alu_v : STD_LOGIC;
+    signal w_alu_out : STD_LOGIC_VECTOR (g_bit-1 downto 0); 
+  
+    signal w_mbr_to_amux : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_return_address : STD_LOGIC_VECTOR (g_mmux_bus_size-1 downto 0);
+    signal w_flag_sel : STD_LOGIC;
+    signal w_pc_inc_x : STD_LOGIC;
+    signal w_pc : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+    signal w_pc_plus : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+    signal w_sp_push_x : STD_LOGIC;
+    signal w_sp_pull_x : STD_LOGIC;
+    signal w_sp_next : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+    signal w_mar_a : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_mar_b : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_bank_enter_x : STD_LOGIC;
+    signal w_bank_leave_x : STD_LOGIC;
+    signal w_bank_clear_x : STD_LOGIC;
+    signal w_bank_switch : STD_LOGIC;
+    signal w_bank_d : STD_LOGIC;
+    signal w_seq_z : STD_LOGIC;
+    signal w_seq_n : STD_LOGIC;
+    signal w_mmux_sel : STD_LOGIC_VECTOR (1 downto 0);
+    signal w_mpc_plus : STD_LOGIC_VECTOR (g_mmux_bus_size-1 downto 0);
+    signal w_instruct : STD_LOGIC_VECTOR (g_mmux_bus_size-1 downto 0);
+    signal w_next_mpc : STD_LOGIC_VECTOR (g_mmux_bus_size-1 downto 0);
+    signal w_queue_rd : STD_LOGIC;
+    signal w_address : STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+    signal w_queue_hit : STD_LOGIC;
+    signal w_int_sel : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_int_ctrl : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_int_entry : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_int_taken : STD_LOGIC;
+    signal w_int_level : STD_LOGIC_VECTOR (2 downto 0);
+    signal w_int_reset : STD_LOGIC;
+    signal w_int_wr_sel : STD_LOGIC;
+    signal w_int_wr_ctrl : STD_LOGIC;
+    signal w_int_ack : STD_LOGIC;
+    signal w_event_next : STD_LOGIC_VECTOR (g_bit-1 downto 0);
+    signal w_wait_d : STD_LOGIC;
+    signal w_rd : STD_LOGIC;
+    signal w_wr : STD_LOGIC;
+    -- RAM access of stage X not finished (all stages held)
+    signal w_mem_stall : STD_LOGIC;
+    signal w_clk_memory : STD_LOGIC;
+    signal w_exec : STD_LOGIC;
+    -- stages F and D held (WAIT or stall)
+    signal w_hold_d : STD_LOGIC;
+    
+    -- microinstruction that decides the next MPC (sequencing)
+    signal w_seq_op : STD_LOGIC;
+    signal w_seq_cond : STD_LOGIC_VECTOR (1 downto 0);
+    signal w_seq_enc : STD_LOGIC;
+    signal w_seq_c : STD_LOGIC_VECTOR (4 downto 0);
+    signal w_seq_address : STD_LOGIC_VECTOR (g_mmux_bus_size-1 downto 0);
+    signal w_seq_mpc : STD_LOGIC_VECTOR (g_mmux_bus_size-1 downto 0);
+    
+    -- '1': next MPC depends on the flags or IR (decided in stage X)
+    signal w_late_d : STD_LOGIC;
+    signal w_late_x : STD_LOGIC;
+   
+    signal w_amux_in : t_MUX_ARRAY 
+        (0 to 2**g_amux_sel_size-1, g_bit-1 downto 0);
+    signal w_mmux_in : t_MUX_ARRAY 
+        (0 to 2**g_mmux_sel_size-1, g_mmux_bus_size-1 downto 0);
+    
+    -- bit size of the opcode (lower bits of the IR)
+    constant c_opcode_size : positive := g_mmux_bus_size - 4;
+    
+    -- constant used for interrupts (definition of no event)
+    constant c_no_event : STD_LOGIC_VECTOR (g_bit-1 downto 0) 
+        := (g_bit-1 => '1', others => '0');
+        
+    -- auxiliary commands (C-field of the MIR if ENC is cleared)
+    -- (the lock of TAS, "10110", is not decoded: there is no arbiter for this
+    -- processor, so TAS is a read followed by a write)
+    constant c_aux_sel_cv : STD_LOGIC_VECTOR (4 downto 0) := "11110";
+    constant c_aux_pc_inc : STD_LOGIC_VECTOR (4 downto 0) := "11101";
+    constant c_aux_sp_push : STD_LOGIC_VECTOR (4 downto 0) := "11100";
+    constant c_aux_sp_pull : STD_LOGIC_VECTOR (4 downto 0) := "11011";
+    constant c_aux_bank_enter : STD_LOGIC_VECTOR (4 downto 0) := "11010";
+    constant c_aux_bank_leave : STD_LOGIC_VECTOR (4 downto 0) := "11001";
+    constant c_aux_bank_clear : STD_LOGIC_VECTOR (4 downto 0) := "11000";
+    constant c_aux_wait : STD_LOGIC_VECTOR (4 downto 0) := "10111";
+    
+    -- IR (C-bus address)
+    constant c_ir : STD_LOGIC_VECTOR (4 downto 0) := "01110";
+    
+    -- conditional jump or dispatch
+    function late_decision (op : STD_LOGIC; cond : STD_LOGIC_VECTOR) 
+        return STD_LOGIC is
+    begin
+      if (op = '0' AND (cond = "01" OR cond = "10")) OR
+         (op = '1' AND (cond = "00" OR cond = "11")) then
+        return '1';
+      else
+        return '0';
+      end if;
+    end function;
+    
+begin
+
+  -------------------------------------------------------------------------------- 
+  -- connect components
+  --
+  
+    Communication_inst : entity work.Communication
+      generic map ( 
+        g_bit => g_bit,
+        g_queue_depth => g_queue_depth
+      )
+      port map (
+        i_CLK_MAR => i_CLK,
+        i_CLK_MBR => i_CLK,
+        i_CLK_MEMORY => w_clk_memory,
+        i_ENABLE => w_exec,
+        i_QUEUE_READY => i_READY,
+        i_CONTROL => r_COMMUNICATION_X,
+        i_DATA_FROM_ALU => w_alu_out,
+        i_A_REG => w_mar_a,
+        i_B_REG => w_mar_b,
+        o_DATA_TO_AMUX => w_mbr_to_amux,
+        o_ADDRESS => w_address,
+        o_QUEUE_RD => w_queue_rd,
+        o_QUEUE_HIT => w_queue_hit,
+        i_SNOOP_WR => i_SNOOP_WR,
+        i_SNOOP_ADDRESS => i_SNOOP_ADDRESS,
+        io_DATA_MEM => IO_DATA
+      );
+             
+    Microsequencer_inst: entity work.Microsequencer
+      generic map (
+        g_address_size => g_mmux_bus_size,
+        g_stack_depth => g_micro_stack_depth
+      )
+      port map ( 
+        i_CLK => i_CLK,
+        i_HOLD => w_mem_stall,
+        i_Z => w_seq_z,
+        i_N => w_seq_n,
+        i_C => w_alu_c,
+        i_V => w_alu_v,
+        i_FLAG_SEL => w_flag_sel,
+        i_OP => w_seq_op,
+        i_COND => w_seq_cond,
+        i_RETURN_ADDRESS => w_mpc_plus,
+        o_RETURN_ADDRESS => w_return_address,
+        o_MMUX_SEL => w_mmux_sel
+      ); 
+   
+    -- the sequencer uses the new flags (loaded at the end of stage X)
+    ALU_inst: entity work.ALU
+      generic map( 
+        g_bit => g_bit,
+        g_adder_style => g_adder_style
+      )
+      port map ( 
+        i_ALU_A => w_alu_a,
+        i_ALU_B => r_B_REG,
+        i_SEL => r_ALU_X,
+        i_CLK => i_CLK,
+        i_ENABLE => w_exec,
+        o_ALU_OUT => w_alu_out,
+        o_Z_FLAG => open,
+        o_N_FLAG => open,             
+        o_V_FLAG => open,
+        o_C_FLAG => open,
+        o_Z_NEXT => w_alu_z,
+        o_N_NEXT => w_alu_n,             
+        o_V_NEXT => w_alu_v,
+        o_C_NEXT => w_alu_c
+      );
+ 
+    Amux: entity work.MUX
+      generic map ( 
+        g_bus_size => g_bit,
+        g_sel_size => g_amux_sel_size
+      )
+      port map ( 
+        i_SELECT(0) => r_AMUX_X,
+        i_INPUTS => w_amux_in,
+        o_OUTPUT => w_alu_a
+      );
+                         
+    Mmux: entity work.MUX
+      generic map ( 
+        g_bus_size => g_mmux_bus_size,
+        g_sel_size => g_mmux_sel_size
+      )
+      port map ( 
+        i_SELECT => w_mmux_sel,
+        i_INPUTS => w_mmux_in,
+        o_OUTPUT => w_next_mpc
+      );         
+                         
+        
+    EventController_int: entity work.Event_Controller
+      generic map ( 
+        g_bit_size_counter => g_debounce_counter_bit_size,
+        g_bit_size => g_bit,
+        g_int_lines => g_interrupt_line_size,
+        g_direct_lines => g_direct_interrupt_lines
+      )
+      port map ( 
+        i_RESET => i_RESET_PIN,
+        i_CLK => i_CLK,
+        i_INTERRUPT => i_INTERRUPT,
+        o_INTERRUPT => w_int_pulse,
+        o_event_control => w_event_control
+      );
+      
+    InterruptController_inst: entity work.Interrupt_Controller
+      generic map ( 
+        g_bit => g_bit,
+        g_int_lines => g_interrupt_line_size 
+      )
+      port map ( 
+        i_CLK => i_CLK,
+        i_RESET => w_int_reset,
+        i_INTERRUPT => w_int_pulse,
+        i_LEVEL => w_int_level,
+        i_WR_SEL => w_int_wr_sel,
+        i_WR_CTRL => w_int_wr_ctrl,
+        i_DATA => w_alu_out,
+        i_ACK => w_int_ack,
+        i_SERVED => r_REGISTERS(19),
+        o_SEL => w_int_sel,
+        o_CTRL => w_int_ctrl,
+        o_ENTRY_CC => w_int_entry,
+        o_TAKEN => w_int_taken,
+        o_EVENT_CONTROL => w_int_event
+      );
+    
+    
+  -------------------------------------------------------------------------------- 
+  -- processes for connecting the multiplexers correctly  
+  --
+    
+    PROC_amux_connect: process(r_A_REG, w_mbr_to_amux)
+    begin
+      for i in 0 to g_bit-1 loop
+        w_amux_in(0,i) <= r_A_REG(i);
+        w_amux_in(1,i) <= w_mbr_to_amux(i);
+      end loop;
+    end process PROC_amux_connect;
+    
+    PROC_mmux_connect: process(w_mpc_plus, w_seq_address, w_instruct,
+        w_return_address)
+    begin
+      for i in 0 to g_mmux_bus_size-1 loop
+        w_mmux_in(0,i) <= w_mpc_plus(i);
+        w_mmux_in(1,i) <= w_instruct(i);
+        w_mmux_in(2,i) <= w_seq_address(i);
+        w_mmux_in(3,i) <= w_return_address(i);
+      end loop;
+    end process PROC_mmux_connect;
+    
+    
+  -------------------------------------------------------------------------------- 
+  -- sequencing
+  --
+  
+    w_mir_d <= r_MIR when r_MIR_VALID = '1' else c_nop_mir;
+    
+    w_late_d <= late_decision(w_OP_D, w_COND_D);
+    w_late_x <= late_decision(r_OP_X, r_COND_X);
+    
+    -- a late decision in stage X has priority (stage D is empty then), an 
+    -- empty microinstruction keeps the stack unchanged if stage D has to 
+    -- wait for its own decision
+    PROC_seq_select: process(w_late_x, w_late_d, r_MIR_X, r_MPC_X, w_mir_d, 
+        r_MPC)
+    begin
+      if w_late_x = '1' then
+        w_seq_op <= r_OP_X;
+        w_seq_cond <= r_COND_X;
+        w_seq_enc <= r_ENC_X;
+        w_seq_c <= r_C_X;
+        w_seq_address <= r_ADDRESS_X;
+        w_seq_mpc <= r_MPC_X;
+      elsif w_late_d = '0' then
+        w_seq_op <= w_OP_D;
+        w_seq_cond <= w_COND_D;
+        w_seq_enc <= w_ENC_D;
+        w_seq_c <= w_C_D;
+        w_seq_address <= w_ADDRESS_D;
+        w_seq_mpc <= r_MPC;
+      else
+        w_seq_op <= '0';
+        w_seq_cond <= "00";
+        w_seq_enc <= '0';
+        w_seq_c <= "11111";
+        w_seq_address <= (others => '0');
+        w_seq_mpc <= r_MPC;
+      end if;
+    end process PROC_seq_select;
+    
+    -- auxiliary command decoder
+    w_flag_sel <= '1' when (w_seq_enc = '0' AND w_seq_c = c_aux_sel_cv) 
+                  else '0';
+    
+    -- bank switch of ENTER and LEAVE in stage X replaces Z and N (not Z)
+    w_seq_z <= w_bank_switch 
+                 when (w_seq_enc = '0' AND (w_seq_c = c_aux_bank_enter OR 
+                                            w_seq_c = c_aux_bank_leave))
+               else w_alu_z;
+    w_seq_n <= NOT(w_bank_switch) 
+                 when (w_seq_enc = '0' AND (w_seq_c = c_aux_bank_enter OR 
+                                            w_seq_c = c_aux_bank_leave))
+               else w_alu_n;
+  
+    -- instruction decoder (IR forwarded if loaded by the dispatching 
+    -- microinstruction)
+    w_instruct <= w_alu_out(c_opcode_size-1 downto 0) & "0000" 
+                    when (r_ENC_X = '1' AND r_C_X = c_ir) 
+                  else r_REGISTERS(14)(c_opcode_size-1 downto 0) & "0000";
+    
+    w_mpc_plus <= STD_LOGIC_VECTOR(UNSIGNED(w_seq_mpc) + 1);
+  
+  
+  -------------------------------------------------------------------------------- 
+  -- clocked processes
+  --
+  
+    -- stage F (one ROM)
+    MPM_BLOCK: if g_mpm_style = "BLOCK" generate
+      -- only for signal rom_style can be defined (not for a constant)
+      signal r_MPM : t_ROM (0 to 2**g_mmux_bus_size-1) := 
+          initRom("..\..\..\ROM_File\ROM_MEM.txt", 2**g_mmux_bus_size-1);
+    
+      attribute rom_style of r_MPM : signal is "block";
+    begin
+      PROC_fetch: process (i_CLK)
+      begin
+        if rising_edge(i_CLK) then
+          if w_hold_d = '0' then
+            r_MIR <= r_MPM(to_integer(UNSIGNED(w_next_mpc)));
+          end if;
+        end if;
+      end process PROC_fetch;
+    end generate MPM_BLOCK;
+    
+    
+    -- stage F (microprogram as combinational logic)
+    MPM_LOGIC: if g_mpm_style = "LOGIC" generate
+      signal w_mpm_logic : STD_LOGIC_VECTOR (39 downto 0);
+    begin
+      MPM_Logic_inst: entity work.MPM_Logic
+        port map (
+          i_MPC => w_next_mpc,
+          o_MIR => w_mpm_logic
+        );
+        
+      PROC_fetch: process (i_CLK)
+      begin
+        if rising_edge(i_CLK) then
+          if w_hold_d = '0' then
+            r_MIR <= w_mpm_logic;
+          end if;
+        end if;
+      end process PROC_fetch;
+    end generate MPM_LOGIC;
+    
+    
+    -- stages D and X
+    -- reset- and interrupt-pin (event) also synchronous to clock
+    PROC_pipeline: process (i_CLK)
+    begin
+      if rising_edge(i_CLK) then
+        -- stage X: load internal registers (not for a stall)
+        if w_mem_stall = '1' then
+          null;
+        elsif (r_ENC_X = '1') then
+           
+          -- synthesis translate_off
+          -- no write operation to registers with constants allowed (ISEL and
+          -- ICTRL are registers of the interrupt controller)
+          assert( (to_integer(UNSIGNED(r_C_X)) < 20) OR
+                  (to_integer(UNSIGNED(r_C_X)) = 21) OR
+                  (to_integer(UNSIGNED(r_C_X)) = 22) )
+          report("C-Bus-Error: Unallowed write! (microcode wrong)")
+          severity failure;
+          
+          -- only "no_event"-constant or available hardware interrupt-vector- 
+          -- number is allowed to be loaded into the EVENT register
+          if to_integer(UNSIGNED(r_C_X)) = 15 then
+            assert( (w_alu_out = c_no_event) OR 
+                ((to_integer(UNSIGNED(w_alu_out)) > 1 ) AND
+                 (to_integer(UNSIGNED(w_alu_out)) < (g_interrupt_line_size + 2))))
+            report("C-Bus-Error: Unallowed write content for EVENT register!" & 
+                "(microcode wrong)")
+            severity failure;
+          end if;
+          -- synthesis translate_on 
+          
+          -- C decoder
+          if to_integer(UNSIGNED(r_C_X)) < 20 then
+            if r_BANK = '1' AND c_banked(to_integer(UNSIGNED(r_C_X))) = '1' 
+            then
+              r_SHADOW(to_integer(UNSIGNED(r_C_X))) <= w_alu_out;
+            else
+              r_REGISTERS(to_integer(UNSIGNED(r_C_X))) <= w_alu_out;
+            end if;
+          end if;
+        elsif w_pc_inc_x = '1' then
+          if r_BANK = '1' then
+            r_SHADOW(6) <= w_pc_plus(2*g_bit-1 downto g_bit);
+            r_SHADOW(7) <= w_pc_plus(g_bit-1 downto 0);
+          else
+            r_REGISTERS(6) <= w_pc_plus(2*g_bit-1 downto g_bit);
+            r_REGISTERS(7) <= w_pc_plus(g_bit-1 downto 0);
+          end if;
+        elsif w_bank_enter_x = '1' then
+          if r_BANK = '0' then
+            r_BANK <= '1';
+          else
+            r_NEST <= r_NEST + 1;
+          end if;
+        elsif w_bank_leave_x = '1' then
+          if r_BANK = '1' AND r_NEST = 0 then
+            r_BANK <= '0';
+          elsif r_BANK = '1' then
+            r_NEST <= r_NEST - 1;
+          end if;
+        elsif w_bank_clear_x = '1' then
+          r_BANK <= '0';
+          r_NEST <= (others => '0');
+        elsif w_sp_push_x = '1' OR w_sp_pull_x = '1' then
+          r_REGISTERS(4) <= w_sp_next(2*g_bit-1 downto g_bit);
+          r_REGISTERS(5) <= w_sp_next(g_bit-1 downto 0);
+        end if;
+        
+        -- EVENT register (see module "Processor")
+        r_REGISTERS(15) <= w_event_next;
+        
+        -- stage D to stage X (stages F and D are held by a WAIT, all stages by
+        -- a stall)
+        if w_mem_stall = '1' then
+          null;
+        elsif w_wait_d = '1' then
+          r_MIR_X <= c_nop_mir;
+        elsif r_MIR_VALID = '1' then
+          r_MIR_X <= r_MIR;
+          r_MPC_X <= r_MPC;
+          r_A_REG <= w_a_bus;
+          r_B_REG <= w_b_bus;
+        else
+          r_MIR_X <= c_nop_mir;
+        end if;
+        
+        -- stage F to stage D (empty if the next MPC is decided in stage X)
+        if w_hold_d = '0' then
+          r_MPC <= w_next_mpc;
+          if (r_MIR_VALID = '1') AND (w_late_d = '1') then
+            r_MIR_VALID <= '0';
+          else
+            r_MIR_VALID <= '1';
+          end if;
+        end if;
+      end if; 
+    end process PROC_pipeline;
+    
+    
+  -------------------------------------------------------------------------------- 
+  -- further connections
+  --
+
+    -- synthesis translate_off
+    -- the opcode is the lower byte of the IR
+    assert (g_bit >= c_opcode_size)
+    report("Generic error: g_bit has to be at least 8!")
+    severity failure;
+    
+    -- the stage F has no nanoprogram and no prefetch of the MIR
+    assert (g_mpm_style = "BLOCK" OR g_mpm_style = "LOGIC")
+    report("Generic error: g_mpm_style has to be BLOCK or LOGIC!")
+    severity failure;
+    
+    -- it is not possible to read from IR
+    assert ( (to_integer(UNSIGNED(w_A_D)) /= 14) AND 
+             (to_integer(UNSIGNED(w_B_D)) /= 14) )
+    report("C-Bus-Error: Unallowed read (IR-reg)! (microcode wrong)")
+    severity failure;
+    -- synthesis translate_on 
+  
+    -- PC incrementer (stage X, PC of the active bank)
+    w_pc_inc_x <= '1' when (r_ENC_X = '0' AND r_C_X = c_aux_pc_inc) else '0';
+    w_pc <= r_SHADOW(6) & r_SHADOW(7) when r_BANK = '1' else
+            r_REGISTERS(6) & r_REGISTERS(7);
+    w_pc_plus <= STD_LOGIC_VECTOR(UNSIGNED(w_pc) + 1);
+    
+    -- register bank (stage X), stage D reads from the bank that is active 
+    -- after stage X
+    w_bank_enter_x <= '1' when (r_ENC_X = '0' AND r_C_X = c_aux_bank_enter) 
+                      else '0';
+    w_bank_leave_x <= '1' when (r_ENC_X = '0' AND r_C_X = c_aux_bank_leave) 
+                      else '0';
+    w_bank_clear_x <= '1' when (r_ENC_X = '0' AND r_C_X = c_aux_bank_clear) 
+                      else '0';
+    w_bank_switch <= NOT(r_BANK) when w_bank_enter_x = '1' else
+                     r_BANK when (w_bank_leave_x = '1' AND r_NEST = 0) else
+                     '0';
+    w_bank_d <= NOT(r_BANK) when w_bank_switch = '1' else
+                '0' when w_bank_clear_x = '1' else
+                r_BANK;
+    
+    -- interrupt controller (stage X, see module "Processor"), the level is 
+    -- the one of the CC after stage X
+    w_int_reset <= '1' when UNSIGNED(w_event_control) = 0 else '0';
+    w_int_wr_sel <= '1' when (r_ENC_X = '1' AND w_mem_stall = '0' AND
+                              to_integer(UNSIGNED(r_C_X)) = 21) else '0';
+    w_int_wr_ctrl <= '1' when (r_ENC_X = '1' AND w_mem_stall = '0' AND
+                               to_integer(UNSIGNED(r_C_X)) = 22) else '0';
+    w_int_ack <= '1' when (r_ENC_X = '1' AND w_mem_stall = '0' AND
+                           to_integer(UNSIGNED(r_C_X)) = 15) else '0';
+    w_int_level <= w_alu_out(7 downto 5) 
+                     when (r_ENC_X = '1' AND 
+                           to_integer(UNSIGNED(r_C_X)) = 9) else
+                   r_SHADOW(9)(7 downto 5) when w_bank_d = '1' else
+                   r_REGISTERS(9)(7 downto 5);
+    
+    -- EVENT after the clock edge: a reset event is loaded at once, otherwise
+    -- EVENT follows the interrupt controller (a reset has to be served first 
+    -- and a write of the microcode has priority)
+    w_event_next <= (others => '0') when w_int_reset = '1' else
+                    w_alu_out when w_int_ack = '1' else
+                    r_REGISTERS(15) when UNSIGNED(r_REGISTERS(15)) = 0 else
+                    w_int_event;
+    
+    -- WAIT in stage D (the jump of the microinstruction has no effect on the
+    -- micro-return stack, so the sequencer needs no hold)
+    w_wait_d <= '1' when (r_MIR_VALID = '1' AND w_ENC_D = '0' AND 
+                          w_C_D = c_aux_wait AND w_event_next = c_no_event)
+                else '0';
+    
+    -- RAM access of stage X not finished (a read of the queue is dropped)
+    w_mem_stall <= ((w_rd AND NOT(w_queue_rd)) OR w_wr) AND NOT(i_READY);
+    w_exec <= NOT(w_mem_stall);
+    w_hold_d <= w_wait_d OR w_mem_stall;
+    
+    -- SP unit (stage X): the MAR takes SP - 1 (push) or SP (pull)
+    w_sp_push_x <= '1' when (r_ENC_X = '0' AND r_C_X = c_aux_sp_push) else '0';
+    w_sp_pull_x <= '1' when (r_ENC_X = '0' AND r_C_X = c_aux_sp_pull) else '0';
+    w_sp_next <= STD_LOGIC_VECTOR(
+                   UNSIGNED(r_REGISTERS(4) & r_REGISTERS(5)) - 1) 
+                 when w_sp_push_x = '1' else
+                 STD_LOGIC_VECTOR(
+                   UNSIGNED(r_REGISTERS(4) & r_REGISTERS(5)) + 1);
+    w_mar_a <= w_sp_next(g_bit-1 downto 0) when w_sp_push_x = '1' else
+               r_REGISTERS(5) when w_sp_pull_x = '1' else
+               r_A_REG;
+    w_mar_b <= w_sp_next(2*g_bit-1 downto g_bit) when w_sp_push_x = '1' else
+               r_REGISTERS(4) when w_sp_pull_x = '1' else
+               r_B_REG;
+    
+    PROC_view: process (r_REGISTERS, r_SHADOW, w_bank_d, w_event_next, 
+        w_int_sel, w_int_ctrl, w_int_entry)
+    begin
+      for i in t_REG'range loop
+        if w_bank_d = '1' AND c_banked(i) = '1' then
+          w_view(i) <= r_SHADOW(i);
+        else
+          w_view(i) <= r_REGISTERS(i);
+        end if;
+      end loop;
+      w_view(15) <= w_event_next;
+      w_view(21) <= w_int_sel;
+      w_view(22) <= w_int_ctrl;
+      w_view(23) <= w_int_entry;
+    end process PROC_view;
+    
+    -- A- and B decoder (load A- and B-bus), forwarding of the C-bus (not
+    -- for EVENT and ICTRL), of the PC incrementer, of the SP unit, of the 
+    -- register bank and of EVENT
+    PROC_forward: process(r_ENC_X, r_C_X, w_A_D, w_B_D, w_alu_out, 
+        w_pc_inc_x, w_pc_plus, w_sp_push_x, w_sp_pull_x, w_sp_next, 
+        w_view)
+    begin
+      if r_ENC_X = '1' AND r_C_X = w_A_D AND 
+         to_integer(UNSIGNED(w_A_D)) /= 15 AND 
+         to_integer(UNSIGNED(w_A_D)) /= 22 then
+        w_a_bus <= w_alu_out;
+      elsif w_pc_inc_x = '1' AND to_integer(UNSIGNED(w_A_D)) = 6 then
+        w_a_bus <= w_pc_plus(2*g_bit-1 downto g_bit);
+      elsif w_pc_inc_x = '1' AND to_integer(UNSIGNED(w_A_D)) = 7 then
+        w_a_bus <= w_pc_plus(g_bit-1 downto 0);
+      elsif (w_sp_push_x = '1' OR w_sp_pull_x = '1') AND 
+            to_integer(UNSIGNED(w_A_D)) = 4 then
+        w_a_bus <= w_sp_next(2*g_bit-1 downto g_bit);
+      elsif (w_sp_push_x = '1' OR w_sp_pull_x = '1') AND 
+            to_integer(UNSIGNED(w_A_D)) = 5 then
+        w_a_bus <= w_sp_next(g_bit-1 downto 0);
+      else
+        w_a_bus <= w_view(to_integer(UNSIGNED(w_A_D)));
+      end if;
+      
+      if r_ENC_X = '1' AND r_C_X = w_B_D AND 
+         to_integer(UNSIGNED(w_B_D)) /= 15 AND 
+         to_integer(UNSIGNED(w_B_D)) /= 22 then
+        w_b_bus <= w_alu_out;
+      elsif w_pc_inc_x = '1' AND to_integer(UNSIGNED(w_B_D)) = 6 then
+        w_b_bus <= w_pc_plus(2*g_bit-1 downto g_bit);
+      elsif w_pc_inc_x = '1' AND to_integer(UNSIGNED(w_B_D)) = 7 then
+        w_b_bus <= w_pc_plus(g_bit-1 downto 0);
+      elsif (w_sp_push_x = '1' OR w_sp_pull_x = '1') AND 
+            to_integer(UNSIGNED(w_B_D)) = 4 then
+        w_b_bus <= w_sp_next(2*g_bit-1 downto g_bit);
+      elsif (w_sp_push_x = '1' OR w_sp_pull_x = '1') AND 
+            to_integer(UNSIGNED(w_B_D)) = 5 then
+        w_b_bus <= w_sp_next(g_bit-1 downto 0);
+      else
+        w_b_bus <= w_view(to_integer(UNSIGNED(w_B_D)));
+      end if;
+    end process PROC_forward;
+  
+    -- outputs
+    w_rd <= (r_RD_X AND r_MBR_X AND NOT(w_queue_hit)) OR w_queue_rd;
+    w_wr <= r_WR_X AND NOT(r_MBR_X) AND NOT(r_RD_X); -- not for MAR - 1
+    o_RD <= w_rd;
+    o_WR <= w_wr;
+    -- o_ADDRESS and o_QUEUE_RD change in the same delta cycle
+    o_ADDRESS <= w_address;
+    o_QUEUE_RD <= w_queue_rd;
+    w_clk_memory <= NOT(i_CLK);
+    o_CLK_MEMORY <= w_clk_memory;
+    o_CLK_MAIN <= i_CLK;
+    
+    -- profiling (stage X, not for a stall)
+    o_RETIRE <= '1' when (w_mmux_sel = "01" AND w_late_x = '1' AND 
+                          w_mem_stall = '0') else '0';
+    o_INT_TAKEN <= w_int_taken;
+    
+end Mixed;
@@ -0,0 +1,199 @@
+-- BSD 3-Clause License
+-- 
+-- Copyright (c) 2018, Bernhard Vacarescu
+-- All rights reserved.
+-- 
+-- Redistribution and use in source and binary forms, with or without
+-- modification, are permitted provided that the following conditions are met:
+-- 
+-- * Redistributions of source code must retain the above copyright notice, this
+--   list of conditions and the following disclaimer.
+-- 
+-- * Redistributions in binary form must reproduce the above copyright notice,
+--   this list of conditions and the following disclaimer in the documentation
+--   and/or other materials provided with the distribution.
+-- 
+-- * Neither the name of the copyright holder nor the names of its
+--   contributors may be used to endorse or promote products derived from
+--   this software without specific prior written permission.
+-- 
+-- THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+-- AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+-- IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+-- DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+-- FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+-- DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+-- SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+-- CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+-- OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+-- OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------------
+-- TIMER
+----------------------------------------------------------------------------------
+-- Memory-mapped timer/counter with prescaler, compare register and 
+-- auto-reload. The registers are placed at g_base_address (offset, g_bit bit
+-- each):
+--    0  CTRL      bit 0: run, bit 1: auto-reload, bit 2: interrupt enable, 
+--                 bit 3: clear (counter and prescaler are set to 0, always
+--                 read as 0), bit 7: match flag (read only, cleared by every
+--                 write of CTRL)
+--    1  PRESCALE  the counter counts every PRESCALE + 1 clock cycles
+--    2  COMPH     compare value (2*g_bit bit)
+--    3  COMPL
+--    4  COUNTH    counter (read only, 2*g_bit bit)
+--    5  COUNTL
+-- If the counter reaches the compare value, the next count sets the match 
+-- flag and, if the interrupt is enabled, o_INTERRUPT for one clock cycle. 
+-- With auto-reload the counter starts again at 0 (period: 
+-- (COMP + 1) * (PRESCALE + 1) clock cycles), otherwise the timer stops (run
+-- is cleared, one-shot). 
+-- The bus is the one of the RAM: i_WR writes i_DATA at the rising edge of 
+-- i_CLK (o_CLK_MEMORY of the processor, the timer counts at the same clock), 
+-- o_DATA is the content of the addressed register (asynchronous) and 
+-- o_SELECTED is set if i_ADDRESS is one of the registers (the RAM must not 
+-- answer then). o_INTERRUPT is meant for an interrupt line of the processor
+-- that is not debounced (generic g_direct_interrupt_lines of "Processor").
+-- COUNTH and COUNTL are read by two instructions, so the timer should be 
+-- stopped (or COUNTH read again) for a consistent value.
+----------------------------------------------------------------------------------
+
+library IEEE;
+use IEEE.STD_LOGIC_1164.ALL;
+use IEEE.NUMERIC_STD.ALL;
+
+
+entity Timer is
+    Generic ( 
+      g_bit : positive := 8; -- data bus (address bus: 2*g_bit)
+      g_base_address : natural := 16#FE00#
+    );
+    Port ( 
+      i_CLK : in STD_LOGIC;
+      i_ADDRESS : in STD_LOGIC_VECTOR (2*g_bit-1 downto 0);
+      i_DATA : in STD_LOGIC_VECTOR (g_bit-1 downto 0);
+      i_WR : in STD_LOGIC;
+      o_DATA : out STD_LOGIC_VECTOR (g_bit-1 downto 0);
+      o_SELECTED : out STD_LOGIC;
+      o_INTERRUPT : out STD_LOGIC -- pulse
+    );
+end Timer;
+
+
+
+architecture Behavioral of Timer is
+
+    -- register offsets
+    constant c_ctrl : natural := 0;
+    constant c_prescale : natural := 1;
+    constant c_comp_h : natural := 2;
+    constant c_comp_l : natural := 3;
+    constant c_count_h : natural := 4;
+    constant c_count_l : natural := 5;
+    
+    signal r_RUN : STD_LOGIC := '0';
+    signal r_RELOAD : STD_LOGIC := '0';
+    signal r_INT_ENABLE : STD_LOGIC := '0';
+    signal r_FLAG : STD_LOGIC := '0';
+    signal r_INTERRUPT : STD_LOGIC := '0';
+    
+    signal r_PRESCALE : UNSIGNED (g_bit-1 downto 0) := (others => '0');
+    signal r_PRESCALER : UNSIGNED (g_bit-1 downto 0) := (others => '0');
+    signal r_COMPARE : UNSIGNED (2*g_bit-1 downto 0) := (others => '1');
+    signal r_COUNT : UNSIGNED (2*g_bit-1 downto 0) := (others => '0');
+    
+    -- offset of the addressed register (only valid if w_selected is set)
+    signal w_offset : natural range 0 to 7;
+    signal w_selected : STD_LOGIC;
+    signal w_write : STD_LOGIC;
+
+begin
+
+    w_selected <= '1' when (UNSIGNED(i_ADDRESS) >= g_base_address AND
+                            UNSIGNED(i_ADDRESS) <= g_base_address + c_count_l)
+                  else '0';
+    w_offset <= to_integer(UNSIGNED(i_ADDRESS) - g_base_address) 
+                  when w_selected = '1' else 0;
+    w_write <= i_WR AND w_selected;
+    
+    
+    PROC_timer: process (i_CLK)
+    begin
+      if rising_edge(i_CLK) then
+        r_INTERRUPT <= '0';
+      
+        -- counting
+        if r_RUN = '1' then
+          if r_PRESCALER = r_PRESCALE then
+            r_PRESCALER <= (others => '0');
+            if r_COUNT = r_COMPARE then
+              r_FLAG <= '1';
+              r_INTERRUPT <= r_INT_ENABLE;
+              if r_RELOAD = '1' then
+                r_COUNT <= (others => '0');
+              else
+                r_RUN <= '0';
+              end if;
+            else
+              r_COUNT <= r_COUNT + 1;
+            end if;
+          else
+            r_PRESCALER <= r_PRESCALER + 1;
+          end if;
+        end if;
+        
+        -- bus write (has priority)
+        if w_write = '1' then
+          case w_offset is
+            when c_ctrl =>
+              r_RUN <= i_DATA(0);
+              r_RELOAD <= i_DATA(1);
+              r_INT_ENABLE <= i_DATA(2);
+              r_FLAG <= '0';
+              if i_DATA(3) = '1' then
+                r_PRESCALER <= (others => '0');
+                r_COUNT <= (others => '0');
+              end if;
+            when c_prescale =>
+              r_PRESCALE <= UNSIGNED(i_DATA);
+            when c_comp_h =>
+              r_COMPARE(2*g_bit-1 downto g_bit) <= UNSIGNED(i_DATA);
+            when c_comp_l =>
+              r_COMPARE(g_bit-1 downto 0) <= UNSIGNED(i_DATA);
+            when others =>
+              null; -- counter is read only
+          end case;
+        end if;
+      end if;
+    end process PROC_timer;
+    
+    
+    -- read access
+    PROC_read: process (w_offset, r_RUN, r_RELOAD, r_INT_ENABLE, r_FLAG,
+        r_PRESCALE, r_COMPARE, r_COUNT)
+    begin
+      o_DATA <= (others => '0');
+      case w_offset is
+        when c_ctrl =>
+          o_DATA(0) <= r_RUN;
+          o_DATA(1) <= r_RELOAD;
+          o_DATA(2) <= r_INT_ENABLE;
+          o_DATA(7) <= r_FLAG;
+        when c_prescale =>
+          o_DATA <= STD_LOGIC_VECTOR(r_PRESCALE);
+        when c_comp_h =>
+          o_DATA <= STD_LOGIC_VECTOR(r_COMPARE(2*g_bit-1 downto g_bit));
+        when c_comp_l =>
+          o_DATA <= STD_LOGIC_VECTOR(r_COMPARE(g_bit-1 downto 0));
+        when c_count_h =>
+          o_DATA <= STD_LOGIC_VECTOR(r_COUNT(2*g_bit-1 downto g_bit));
+        when c_count_l =>
+          o_DATA <= STD_LOGIC_VECTOR(r_COUNT(g_bit-1 downto 0));
+        when others =>
+          null;
+      end case;
+    end process PROC_read;
+    
+    o_SELECTED <= w_selected;
+    o_INTERRUPT <= r_INTERRUPT;
+
+end Behavioral;
@@ -38,7 +38,13 @@ use IEEE.STD_LOGIC_1164.ALL;
 
 
 package datatypes is
+    -- maximum word size of a RAM (data bus size g_bit of the processor: 8 or
+    -- 16), a RAM for a smaller word size only uses the lower bits of a word
+    constant c_max_word_size : positive := 16;
+    
     type t_MUX_ARRAY is array(natural range <>, natural range <>) of STD_LOGIC;
-    type t_ROM is array (0 to 4095) of STD_LOGIC_VECTOR (39 downto 0); -- MPM
-    type t_RAM is array (natural range <>) of STD_LOGIC_VECTOR (7 downto 0);
+    -- MPM
+    type t_ROM is array (natural range <>) of STD_LOGIC_VECTOR (39 downto 0);
+    type t_RAM is array (natural range <>) 
+        of STD_LOGIC_VECTOR (c_max_word_size-1 downto 0);
 end package;
\ No newline at end of file
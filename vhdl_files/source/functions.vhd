@@ -44,18 +44,23 @@ use work.datatypes.all;
 
 package functions is
     -- functions to initialize a memory 
-    impure function initRom (RomFileName : in string) return t_ROM;
-    -- Ending: last address of the RAM
-    impure function initRam (RamFileName : in string; Ending : in positive) return t_RAM;
+    -- Ending: last address of the ROM/RAM
+    impure function initRom (RomFileName : in string; Ending : in positive) 
+        return t_ROM;
+    -- Width: word size of the RAM file (hexadecimal, Width/4 digits per line), 
+    -- loaded into the lower bits of the words
+    impure function initRam (RamFileName : in string; Ending : in positive;
+        Width : in positive) return t_RAM;
 end;
 
 package body functions is
-    impure function initRom (RomFileName : in string) return t_ROM is
+    impure function initRom (RomFileName : in string; Ending : in positive) 
+        return t_ROM is
       FILE f_rom_file : TEXT open READ_MODE is RomFileName;
       variable v_line_pointer_read : LINE;
-      variable v_temp_mem : t_ROM;
+      variable v_temp_mem : t_ROM (0 to Ending);
     begin
-      for i in t_ROM'range loop
+      for i in 0 to Ending loop
         readline(f_rom_file, v_line_pointer_read);
         read(v_line_pointer_read, v_temp_mem(i));
       end loop;
@@ -66,14 +71,17 @@ package body functions is
     end function;
     
     
-    impure function initRam (RamFileName : in string; Ending : in positive) return t_RAM is
+    impure function initRam (RamFileName : in string; Ending : in positive;
+        Width : in positive) return t_RAM is
       FILE f_ram_file : TEXT open READ_MODE is RamFileName;
       variable v_line_pointer_read : LINE;
-      variable v_temp_mem : t_RAM (0 to Ending) := (others => "00000000");
+      variable v_word : STD_LOGIC_VECTOR (Width-1 downto 0);
+      variable v_temp_mem : t_RAM (0 to Ending) := (others => (others => '0'));
     begin
       for i in 0 to Ending loop
         readline(f_ram_file, v_line_pointer_read);
-        hread(v_line_pointer_read, v_temp_mem(i));
+        hread(v_line_pointer_read, v_word);
+        v_temp_mem(i)(Width-1 downto 0) := v_word;
       end loop;
 
       file_close(f_ram_file); 